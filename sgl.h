@@ -15,11 +15,79 @@
 typedef float f32;
 typedef double f64;
 
+// Defaults of SGL_Config, sgl_InitEx takes the actual limits at runtime
+#ifndef SGL_MAX_INSTANCES
 #define SGL_MAX_INSTANCES 10000
+#endif
 
+#ifndef SGL_TEXTURE_SIZE
 #define SGL_TEXTURE_SIZE 512
+#endif
+#ifndef SGL_MAX_TEXTURES
 #define SGL_MAX_TEXTURES 256
+#endif
 #define SGL_MAX_TEXTURE_SLOTS 8
+#define SGL_MAX_BATCH_CAMERAS 8 // matrices per batch, matches `cameras[]` in the vertex shaders
+
+#ifndef SGL_TEXTURE_INITIAL_LAYERS
+#define SGL_TEXTURE_INITIAL_LAYERS 8 // the array grows on demand up to maxTextures
+#endif
+
+#ifndef SGL_MAX_PIPELINE_VARIANTS
+#define SGL_MAX_PIPELINE_VARIANTS 64 // (shaders, state) combinations kept alive
+#endif
+
+#ifndef SGL_SHADER_DIR
+#define SGL_SHADER_DIR "shaders/" // where optional compute shaders (.spv) are loaded from
+#endif
+
+#ifndef SGL_OCCLUSION_BATCHES
+#define SGL_OCCLUSION_BATCHES 4 // opaque 3D instances per frame, in full batches (maxInstances)
+#endif
+
+#ifndef SGL_SCENE_LEAF_SIZE
+#define SGL_SCENE_LEAF_SIZE 4 // objects per BVH leaf in retained scenes
+#endif
+
+#ifndef SGL_POLYLINE_BATCH_MAX
+#define SGL_POLYLINE_BATCH_MAX 64 // longer polylines get their own upload and draw
+#endif
+
+#ifndef SGL_CAPTURE_RING
+#define SGL_CAPTURE_RING 3 // download buffers of sgl_CaptureFrameAsync, captures in flight at once
+#endif
+
+#ifndef SGL_TEXTURE_PACK_CHUNK
+#define SGL_TEXTURE_PACK_CHUNK 16 // layers per transfer buffer fill in sgl_LoadTexturePack
+#endif
+
+#ifndef SGL_SPRITE_POOL_MERGE_GAP
+#define SGL_SPRITE_POOL_MERGE_GAP 8 // clean sprites uploaded along to join two dirty ranges
+#endif
+
+#ifndef SGL_LOW_POWER_TIMEOUT_MS
+#define SGL_LOW_POWER_TIMEOUT_MS 1000 // longest idle sleep in low power mode before re-checking
+#endif
+
+#ifndef SGL_STATS_HISTORY
+#define SGL_STATS_HISTORY 240 // frames kept for percentile reporting
+#endif
+
+#ifndef SGL_FRAME_HISTOGRAM_BINS
+#define SGL_FRAME_HISTOGRAM_BINS 400 // frame time histogram, the last bin counts everything longer
+#endif
+#ifndef SGL_FRAME_HISTOGRAM_BIN_MS
+#define SGL_FRAME_HISTOGRAM_BIN_MS 0.1
+#endif
+
+// Trace markers: define SGL_ENABLE_TRACE before including to record them,
+// otherwise every SGL_TRACE_* macro compiles to nothing.
+#ifndef SGL_TRACE_CAPACITY
+#define SGL_TRACE_CAPACITY 16384 // events per thread ring
+#endif
+#ifndef SGL_TRACE_MAX_THREADS
+#define SGL_TRACE_MAX_THREADS 16
+#endif
 
 typedef struct {
 	uint8_t r, g, b, a;
@@ -68,16 +136,186 @@ typedef struct {
 	f32 height;
 } SGL_Texture;
 
+// Textures baked offline by sgl_WriteTexturePack, uploaded together by sgl_LoadTexturePack
+typedef struct SGL_TexturePack SGL_TexturePack;
+
+// Tile grid drawn with one quad per region, tile indices live on the GPU.
+// Tile value 0 is empty, n >= 1 draws cell n - 1 of the tileset (row major).
+typedef struct SGL_Tilemap SGL_Tilemap;
+
+// Voxel chunk palette entry. Block value 0 is air, 1..255 index the palette.
+typedef struct {
+	SGL_Texture* top;	 // +Y faces, NULL = solid color
+	SGL_Texture* side;	 // X and Z faces
+	SGL_Texture* bottom; // -Y faces
+	SGL_COLOR color;
+} SGL_VoxelMaterial;
+
+typedef struct SGL_VoxelChunk SGL_VoxelChunk;
+
+// 2D particle emitter settings, can be changed every frame without any upload
+typedef struct {
+	Vec2 position; // where particles spawn
+	Vec2 velocity;
+	Vec2 velocityRandom; // -this..+this added per axis on spawn
+	Vec2 gravity;		 // acceleration, world units / s^2
+	f32 lifetime;		 // seconds
+	f32 lifetimeRandom;	 // 0..this added on spawn
+	f32 emitRate;		 // particles per second
+	f32 sizeStart, sizeEnd;
+	SGL_COLOR colorStart, colorEnd;
+	SGL_Texture* texture; // NULL = circles
+} SGL_ParticleConfig;
+
+typedef struct SGL_ParticleSystem SGL_ParticleSystem;
+
+// Retained 3D scene kept in a BVH. Objects are referenced by handle, 0 = none.
+// Handles of removed objects may be reused after the next rebuild.
+typedef struct SGL_Scene SGL_Scene;
+typedef uint32_t SGL_SceneHandle;
+
+// Long-lived sprites kept on the GPU, only changed ones are uploaded again
+typedef struct SGL_SpritePool SGL_SpritePool;
+typedef uint32_t SGL_SpriteHandle; // 0 = invalid
+
+// Offscreen target backed by one layer of the texture array.
+// Draw the result with sgl_DrawTexture(&target->texture, ...).
+typedef struct {
+	SGL_Texture texture;
+	bool dirty;			 // set it when the content has to be drawn again
+	uint32_t generation; // texture array generation it was rendered into
+} SGL_RenderTexture;
+
+// Pipeline render state, combined with the active shaders to pick a cached pipeline variant
+typedef enum {
+	SGL_BLEND_ALPHA = 0, // default
+	SGL_BLEND_NONE,		 // opaque
+	SGL_BLEND_ADDITIVE,
+	SGL_BLEND_MULTIPLY,
+} SGL_BlendMode;
+
+typedef enum {
+	SGL_DEPTH_READ_WRITE = 0, // default, LESS_OR_EQUAL
+	SGL_DEPTH_READ_ONLY,	  // test but don't write
+	SGL_DEPTH_OFF,
+} SGL_DepthMode;
+
+typedef enum {
+	SGL_CULL_NONE = 0, // default
+	SGL_CULL_BACK,
+	SGL_CULL_FRONT,
+} SGL_CullMode;
+
+// Why a batch was flushed to the GPU
+typedef enum {
+	SGL_FLUSH_CAPACITY = 0, // instance buffer ran full
+	SGL_FLUSH_MODE_SWITCH,	// 2D <-> 3D switch
+	SGL_FLUSH_END_FRAME,	// sgl_EndDrawing
+	SGL_FLUSH_STATE_CHANGE, // pipeline, blend, depth or cull mode changed
+	SGL_FLUSH_RETAINED,		// a retained draw (voxel chunk, particles) needs its own pass
+	SGL_FLUSH_TARGET_CHANGE, // sgl_BeginTextureMode / sgl_EndTextureMode
+	SGL_FLUSH_CAMERA_CHANGE, // camera table full, or the batch can only have one camera
+	SGL_FLUSH_REASON_COUNT,
+} SGL_FlushReason;
+
+typedef struct {
+	uint32_t instances; // instances submitted this frame
+	uint32_t flushCount;
+	uint32_t flushReasons[SGL_FLUSH_REASON_COUNT]; // indexed by SGL_FlushReason
+	uint32_t renderPasses;
+	uint32_t drawCalls;
+	uint64_t instanceBytesUploaded;
+	uint64_t textureBytesUploaded;
+	f64 swapchainWaitMs; // time blocked acquiring the swapchain texture
+	f64 cpuFrameMs;		 // sgl_BeginDrawing -> sgl_EndDrawing
+	f64 frameMs;		 // previous sgl_EndDrawing -> this one, limiter included
+	f64 limiterWaitMs;	 // time slept/spun by sgl_SetTargetFPS
+	bool skipped;		 // no swapchain image (non-blocking acquire, window hidden)
+	uint32_t culled;	 // instances rejected by 2D view culling or scene frustum culling
+	uint32_t specializedBatches; // flushes drawn with a shader variant (sgl_SetShaderVariants)
+	uint32_t capturesDropped;	 // capture requests refused or lost (ring full, no swapchain image)
+	uint32_t textureCacheHits;	 // loads/creates answered with an existing texture
+	int textureLayersUsed;
+	int textureLayersFree;	   // of SGL_Config.maxTextures
+	int textureLayersCapacity; // layers currently allocated on the GPU
+} SGL_FrameStats;
+
+// Pixels of a finished capture, valid only during the callback. Rows are tightly packed.
+typedef struct {
+	const void* pixels;
+	int width, height;
+	int pitch;					 // bytes per row
+	SDL_GPUTextureFormat format; // swapchain format (often B8G8R8A8_UNORM) or R8G8B8A8_UNORM
+	uint64_t frame;				 // frames drawn before the captured one
+} SGL_CaptureFrame;
+
+// Runs on the capture worker thread, one capture at a time in frame order
+typedef void (*SGL_CaptureCallback)(const SGL_CaptureFrame* frame, void* userdata);
+
+// Fixed timestep accumulator, see sgl_FixedStepAdvance
+typedef struct {
+	f64 step;		 // seconds per update
+	f64 maxFrame;	 // longest frame time fed in, avoids a spiral of updates after a stall
+	f64 accumulator; // time not yet consumed by updates
+} SGL_FixedStep;
+
+// Window, device and renderer limits, start from sgl_DefaultConfig
+typedef struct {
+	int width, height;
+	const char* title;
+	SDL_WindowFlags windowFlags;
+
+	int maxInstances;		  // per batch, sizes the instance and staging buffers
+	int textureSize;		  // width and height of every texture array layer
+	int maxTextures;		  // layers the texture array may grow to
+	int initialTextureLayers; // allocated at init
+
+	SDL_GPUTextureFormat depthFormat; // falls back to D16_UNORM when unsupported
+	SDL_GPUFilter textureFilter;	  // of the texture array sampler
+	SDL_GPUPresentMode presentMode;
+	int framesInFlight; // 1..3, 0 = SDL default
+
+	const char* gpuDriver; // "vulkan", "metal", ... NULL = let SDL pick
+	bool gpuDebug;		   // backend validation layers
+} SGL_Config;
+
 // -- API --
-void sgl_InitWindow(int w, int h, const char* title);
+SGL_Config sgl_DefaultConfig(void);
+bool sgl_InitEx(const SGL_Config* config);
+void sgl_InitWindow(int w, int h, const char* title); // sgl_InitEx with the defaults
 void sgl_Shutdown(void);
 
-// Texture API
+// Texture API (handles are shared and reference counted, every create/load/retain needs a destroy)
 SGL_Texture* sgl_CreateTexture(void* pixels, int width, int height);
-SGL_Texture* sgl_LoadTexture(const char* filename); // Uses SDL_LoadBMP
-void sgl_DestroyTexture(SGL_Texture* texture);
+SGL_Texture* sgl_LoadTexture(const char* filename); // Uses SDL_LoadBMP, cached by path
+SGL_Texture* sgl_RetainTexture(SGL_Texture* texture);
+void sgl_DestroyTexture(SGL_Texture* texture); // the layer is freed with the last reference
+int sgl_GetTextureRefCount(const SGL_Texture* texture); // 0 for pack and render textures
+void sgl_SetTextureDedup(bool enable); // sgl_CreateTexture shares textures with identical pixels
 void sgl_DrawTexture(SGL_Texture* texture, f32 x, f32 y, f32 w, f32 h, SGL_COLOR tint);
 
+// Texture Packs (layers already converted and sized, no decoding at load)
+bool sgl_WriteTexturePack(const char* path, const char* const* files, int count, int layerSize); // offline, no GPU needed
+SGL_TexturePack* sgl_LoadTexturePack(const char* path); // layer size must match SGL_Config.textureSize
+void sgl_DestroyTexturePack(SGL_TexturePack* pack);		 // frees the layers of all its textures
+int sgl_GetTexturePackCount(const SGL_TexturePack* pack);
+SGL_Texture* sgl_GetPackTexture(SGL_TexturePack* pack, int index); // owned by the pack
+SGL_Texture* sgl_FindPackTexture(SGL_TexturePack* pack, const char* name); // source file name without directories
+
+// Render Textures (width/height up to SGL_Config.textureSize)
+SGL_RenderTexture* sgl_CreateRenderTexture(int width, int height);
+void sgl_DestroyRenderTexture(SGL_RenderTexture* target);
+bool sgl_BeginTextureMode(SGL_RenderTexture* target); // false = still clean, skip drawing it
+void sgl_EndTextureMode(void);
+
+// Tilemaps (tileset is an array texture, tileSize is the cell size in its pixels)
+SGL_Tilemap* sgl_CreateTilemap(int width, int height, SGL_Texture* tileset, int tileSize);
+void sgl_DestroyTilemap(SGL_Tilemap* map);
+void sgl_SetTile(SGL_Tilemap* map, int x, int y, uint16_t tile);
+uint16_t sgl_GetTile(SGL_Tilemap* map, int x, int y);
+void sgl_SetTiles(SGL_Tilemap* map, int x, int y, int w, int h, const uint16_t* tiles); // [x + w * y]
+void sgl_DrawTilemap(SGL_Tilemap* map, f32 x, f32 y, f32 tileWorldSize, SGL_COLOR tint);
+
 // input control
 bool sgl_WindowShouldClose(void);
 bool sgl_IsKeyDown(SDL_Scancode key);
@@ -85,12 +323,37 @@ void sgl_SetMouseLock(bool lock);
 f32 sgl_GetMouseWheelY(void);
 
 // Drawing
-void sgl_BeginDrawing(void);
+bool sgl_BeginDrawing(void); // false when the frame was skipped (no swapchain image, window hidden)
 void sgl_EndDrawing(void);
 
+// Low Power (redraw only on input, window events and sgl_RequestRedraw)
+void sgl_SetLowPowerMode(bool enable); // sgl_WindowShouldClose blocks until a redraw is due
+bool sgl_IsLowPowerMode(void);
+void sgl_RequestRedraw(void); // thread safe, wakes a blocked sgl_WindowShouldClose
+
+// Frame Capture (downloaded at sgl_EndDrawing, the callback fires a few frames later)
+bool sgl_CaptureFrameAsync(SGL_CaptureCallback callback, void* userdata); // false = ring full, dropped
+bool sgl_CaptureRenderTextureAsync(SGL_RenderTexture* target, SGL_CaptureCallback callback, void* userdata);
+void sgl_FlushCaptures(void); // blocks until every submitted capture went through its callback
+
+// Frame Pacing (can be called before sgl_InitWindow, applied on init)
+bool sgl_SetPresentMode(SDL_GPUPresentMode mode); // VSYNC, MAILBOX or IMMEDIATE
+bool sgl_SetFramesInFlight(int frames);			  // 1..3, SDL default is 2
+void sgl_SetNonBlockingAcquire(bool enable);	  // skip frames instead of waiting
+void sgl_SetTargetFPS(int fps);					  // limit in sgl_EndDrawing, 0 = unlimited
+f64 sgl_GetFrameTime(void);						  // seconds of the last whole frame
+
+// Fixed Timestep
+void sgl_FixedStepInit(SGL_FixedStep* fs, f64 updatesPerSecond);
+void sgl_FixedStepAdvance(SGL_FixedStep* fs, f64 frameTime); // once per frame
+bool sgl_FixedStepTick(SGL_FixedStep* fs);					 // true while an update is due
+f32 sgl_FixedStepAlpha(const SGL_FixedStep* fs);			 // 0..1 between the last two updates
+
 // 2D Mode
 void sgl_BeginMode2D(SGL_Camera* camera);
 void sgl_EndMode2D(void);
+void sgl_SetViewCulling(bool enable); // skip 2D draws outside the camera view, off by default
+bool sgl_IsViewCullingEnabled(void);
 
 // 3D Mode
 void sgl_BeginMode3D(SGL_Camera3D* camera);
@@ -103,10 +366,56 @@ void sgl_DrawRectangle(f32 x, f32 y, f32 w, f32 h, SGL_COLOR color);
 void sgl_DrawRectanglePro(Rectangle rec, Vec2 origin, float rotation, SGL_COLOR color);
 void sgl_DrawTriangle(f32 x, f32 y, f32 size, SGL_COLOR color);
 void sgl_DrawCircle(f32 x, f32 y, f32 radius, SGL_COLOR color);
+void sgl_DrawRectangleRounded(f32 x, f32 y, f32 w, f32 h, f32 radius, SGL_COLOR color);
+void sgl_DrawRing(f32 x, f32 y, f32 radius, f32 thickness, SGL_COLOR color);
+void sgl_DrawArc(f32 x, f32 y, f32 radius, f32 startAngle, f32 endAngle, f32 thickness, SGL_COLOR color); // radians
+void sgl_DrawLine(f32 x0, f32 y0, f32 x1, f32 y1, f32 thickness, SGL_COLOR color);
+void sgl_DrawPolyline(const Vec2* points, int count, f32 thickness, SGL_COLOR color); // round joins
 
 // 3D Shapes
 void sgl_DrawCube(Vec3 position, f32 size, SGL_Texture* texture, SGL_COLOR color);
 
+// Voxel Chunks (hidden faces are removed on the CPU, the mesh is cached until blocks change)
+SGL_VoxelChunk* sgl_CreateVoxelChunk(int sizeX, int sizeY, int sizeZ);
+void sgl_DestroyVoxelChunk(SGL_VoxelChunk* chunk);
+void sgl_SetVoxelChunkBlocks(SGL_VoxelChunk* chunk, const uint8_t* blocks); // [x + sizeX * (y + sizeY * z)]
+void sgl_SetVoxelChunkBlock(SGL_VoxelChunk* chunk, int x, int y, int z, uint8_t block);
+void sgl_SetVoxelChunkPalette(SGL_VoxelChunk* chunk, const SGL_VoxelMaterial* palette, int count);
+void sgl_SetVoxelChunkGreedy(SGL_VoxelChunk* chunk, bool greedy); // merge coplanar faces, default on
+void sgl_DrawVoxelChunk(SGL_VoxelChunk* chunk, Vec3 origin, f32 blockSize);
+uint32_t sgl_GetVoxelChunkFaceCount(SGL_VoxelChunk* chunk);
+
+// Particles (state lives on the GPU, simulated by SGL_SHADER_DIR "particles.comp.spv")
+SGL_ParticleSystem* sgl_CreateParticleSystem(int maxParticles, const SGL_ParticleConfig* config);
+void sgl_DestroyParticleSystem(SGL_ParticleSystem* ps);
+void sgl_SetParticleConfig(SGL_ParticleSystem* ps, const SGL_ParticleConfig* config);
+void sgl_EmitParticles(SGL_ParticleSystem* ps, int count); // burst on the next update
+void sgl_UpdateParticleSystem(SGL_ParticleSystem* ps, f32 dt); // between Begin/EndDrawing
+void sgl_DrawParticleSystem(SGL_ParticleSystem* ps);		   // inside sgl_BeginMode2D
+
+// Sprite Pools (one draw per pool with the current camera, the upload covers only what changed)
+SGL_SpritePool* sgl_CreateSpritePool(int capacity);
+void sgl_DestroySpritePool(SGL_SpritePool* pool);
+SGL_SpriteHandle sgl_SpritePoolAdd(SGL_SpritePool* pool, f32 x, f32 y, f32 w, f32 h, SGL_Texture* texture, SGL_COLOR color);
+void sgl_SpritePoolRemove(SGL_SpritePool* pool, SGL_SpriteHandle handle);
+void sgl_SpritePoolSetPosition(SGL_SpritePool* pool, SGL_SpriteHandle handle, f32 x, f32 y);
+void sgl_SpritePoolSetRect(SGL_SpritePool* pool, SGL_SpriteHandle handle, f32 x, f32 y, f32 w, f32 h);
+void sgl_SpritePoolSetColor(SGL_SpritePool* pool, SGL_SpriteHandle handle, SGL_COLOR color);
+void sgl_SpritePoolSetTexture(SGL_SpritePool* pool, SGL_SpriteHandle handle, SGL_Texture* texture); // NULL = solid
+int sgl_SpritePoolCount(const SGL_SpritePool* pool);
+void sgl_DrawSpritePool(SGL_SpritePool* pool); // 3D: quads facing +Z in the z = 0 plane
+
+// Retained Scene (frustum culled through a BVH, drawn inside sgl_BeginMode3D)
+SGL_Scene* sgl_CreateScene(void);
+void sgl_DestroyScene(SGL_Scene* scene);
+SGL_SceneHandle sgl_SceneAddCube(SGL_Scene* scene, Vec3 position, f32 size, SGL_Texture* texture, SGL_COLOR color);
+SGL_SceneHandle sgl_SceneAddSprite(SGL_Scene* scene, Vec3 position, f32 w, f32 h, SGL_Texture* texture, SGL_COLOR color); // quad facing +Z, centered
+void sgl_SceneUpdate(SGL_Scene* scene, SGL_SceneHandle handle, Vec3 position); // move, keeps size
+void sgl_SceneRemove(SGL_Scene* scene, SGL_SceneHandle handle);
+void sgl_DrawScene(SGL_Scene* scene);
+SGL_SceneHandle sgl_SceneRaycast(SGL_Scene* scene, Vec3 origin, Vec3 dir, f32 maxDistance, f32* outDistance);
+int sgl_SceneQueryBox(SGL_Scene* scene, Vec3 min, Vec3 max, SGL_SceneHandle* out, int maxOut); // returns total hits
+
 // Pipeline/Shader Control
 SDL_GPUShader* sgl_LoadShader(
 	const char* filename,
@@ -116,9 +425,25 @@ SDL_GPUShader* sgl_LoadShader(
 	int num_samplers
 );
 SDL_GPUGraphicsPipeline* sgl_CreatePipeline(SDL_GPUShader* vert, SDL_GPUShader* frag);
+// Same, but takes ownership of both shaders: sgl_Shutdown releases them
+SDL_GPUGraphicsPipeline* sgl_CreatePipelineOwned(SDL_GPUShader* vert, SDL_GPUShader* frag);
 void sgl_SetPipeline(SDL_GPUGraphicsPipeline* pipeline);
 SDL_GPUGraphicsPipeline* sgl_GetDefaultPipeline(void);
 
+// Render state (variants of the active pipeline are created once and cached).
+// Keep custom shaders alive while using these with a pipeline from sgl_CreatePipeline.
+void sgl_SetBlendMode(SGL_BlendMode mode);
+void sgl_SetDepthMode(SGL_DepthMode mode);
+void sgl_SetCullMode(SGL_CullMode mode);
+
+// Specialized shaders for batches of plain rects or cubes, picked per flush (embedded)
+bool sgl_SetShaderVariants(bool enable);
+bool sgl_IsShaderVariantsEnabled(void);
+
+// Hi-Z occlusion culling of opaque 3D instances (needs SGL_SHADER_DIR/hiz_*.comp.spv)
+bool sgl_SetOcclusionCulling(bool enable);
+bool sgl_IsOcclusionCullingEnabled(void);
+
 // Camera
 void sgl_SetCamera(SGL_Camera* camera);
 void sgl_CameraInit(SGL_Camera* cam, f32 x, f32 y, f32 zoom);
@@ -129,6 +454,25 @@ void sgl_Camera3DUpdate(SGL_Camera3D* cam, SGL_CAMERA_MODE mode, f32 deltaTime);
 uint64_t sgl_GetPerfCount(void);
 uint64_t sgl_GetPerfFreq(void);
 
+// Tracing (Chrome / Perfetto trace-event JSON)
+#ifdef SGL_ENABLE_TRACE
+void sgl_TraceEvent(const char* name, char phase);
+bool sgl_TraceDump(const char* filename); // call while no thread is tracing
+#define SGL_TRACE_BEGIN(name) sgl_TraceEvent(name, 'B')
+#define SGL_TRACE_END(name) sgl_TraceEvent(name, 'E')
+#else
+#define SGL_TRACE_BEGIN(name) ((void)0)
+#define SGL_TRACE_END(name) ((void)0)
+#define sgl_TraceDump(filename) ((void)(filename), false)
+#endif
+
+// Frame Statistics (values of the last finished frame)
+SGL_FrameStats sgl_GetFrameStats(void);
+int sgl_GetFrameStatsHistory(SGL_FrameStats* out, int maxCount); // oldest first
+f64 sgl_GetFrameTimePercentile(f32 percentile);					 // CPU frame ms, 0..100
+int sgl_GetFrameTimeHistogram(uint32_t* out, int maxBins); // frameMs counts per SGL_FRAME_HISTOGRAM_BIN_MS
+void sgl_ResetFrameTimeHistogram(void);
+
 #endif // SGL_H
 
 // ============================================================================
@@ -137,6 +481,14 @@ uint64_t sgl_GetPerfFreq(void);
 
 #ifdef SGL_IMPLEMENTATION
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SGL_HAS_MMAP
+#endif
+
 // For logs things
 
 #define SGL_LOG_CATEGORY SDL_LOG_CATEGORY_CUSTOM
@@ -154,13 +506,41 @@ typedef enum {
 	SGL_SHAPE_RECT = 0,
 	SGL_SHAPE_TRIG = 1,
 	SGL_SHAPE_CIRCLE = 2,
+	SGL_SHAPE_TILEMAP = 3,
+	SGL_SHAPE_LINE = 4,
+	SGL_SHAPE_ROUNDED_RECT = 5,
+	SGL_SHAPE_RING = 6,
+	SGL_SHAPE_ARC = 7,
 } SGL_ShapeType;
 
+// Instance type = shape + camera index * stride, the vertex shaders split it again
+#define SGL_CAMERA_TYPE_STRIDE 256
+
 typedef enum {
 	SGL_BATCH_2D = 0,
 	SGL_BATCH_3D = 1,
 } SGL_BatchMode;
 
+// Packed blend | depth | cull, 0 is the default state
+typedef Uint32 SGL_PipelineState;
+
+#define SGL_PIPELINE_STATE(blend, depth, cull)                                                     \
+	((SGL_PipelineState)(blend) | ((SGL_PipelineState)(depth) << 4) |                              \
+	 ((SGL_PipelineState)(cull) << 8))
+#define SGL_PIPELINE_BLEND(state) ((SGL_BlendMode)((state) & 0xF))
+#define SGL_PIPELINE_DEPTH(state) ((SGL_DepthMode)(((state) >> 4) & 0xF))
+#define SGL_PIPELINE_CULL(state) ((SGL_CullMode)(((state) >> 8) & 0xF))
+#define SGL_PIPELINE_OFFSCREEN (1u << 12) // renders into the texture array format
+
+typedef struct {
+	SDL_GPUShader* vert;
+	SDL_GPUShader* frag;
+	SGL_PipelineState state;
+	SDL_GPUGraphicsPipeline* pipeline;
+	bool owned;		   // created by sgl, released on shutdown
+	bool ownsShaders;  // registered by sgl_CreatePipelineOwned, vert/frag released on shutdown
+} SGL_PipelineVariant;
+
 typedef struct {
 	f32 x, y, w, h; // for 3d object the w is Z and the h is Size
 	f32 angle, ox, oy, z;
@@ -168,14 +548,84 @@ typedef struct {
 	f32 r, g, b, a;
 } SGL_InstanceData;
 
+// Visible world rectangle of a 2D camera, for view culling
+typedef struct {
+	bool valid; // false for a degenerate camera (zoom <= 0)
+	Vec2 min;
+	Vec2 max;
+} SGL_ViewRect;
+
+typedef struct {
+	f32 depth; // view depth of the instance center
+	Uint32 index;
+} SGL_SortKey;
+
+#define SGL_HIZ_MAX_LEVELS 16
+
+// What the current batch holds, decides which shader variant can draw it
+typedef enum {
+	SGL_BATCH_HAS_RECT = 1 << 0,
+	SGL_BATCH_HAS_CUBE = 1 << 1,
+	SGL_BATCH_HAS_OTHER = 1 << 2, // any other shape, only the default shaders draw it
+	SGL_BATCH_HAS_TEXTURE = 1 << 3,
+	SGL_BATCH_HAS_ROTATION = 1 << 4,
+	SGL_BATCH_HAS_SOFT_EDGE = 1 << 5, // see sgl_SoftEdgeState
+} SGL_BatchFeature;
+
+// Built from shaders/variant.vert and shaders/variant.frag
+typedef enum {
+	SGL_VARIANT_QUAD_VERT,
+	SGL_VARIANT_QUAD_ROTATED_VERT,
+	SGL_VARIANT_CUBE_VERT,
+	SGL_VARIANT_SOLID_FRAG,
+	SGL_VARIANT_TEXTURED_FRAG,
+	SGL_VARIANT_SHADER_COUNT
+} SGL_VariantShader;
+
+// Shared handle behind every sgl_CreateTexture / sgl_LoadTexture result
+typedef struct SGL_TextureEntry {
+	SGL_Texture texture; // first, handles point here
+	int refs;
+	Uint64 hash;   // of the pixels with sgl_SetTextureDedup, 0 = not hashed
+	Uint8* pixels; // copy of the hashed pixels, compared on a hash match
+	char* path;	   // of sgl_LoadTexture, NULL for raw pixels
+	struct SGL_TextureEntry* next;
+} SGL_TextureEntry;
+
+typedef enum {
+	SGL_CAPTURE_FREE,
+	SGL_CAPTURE_REQUESTED, // recorded by sgl_EndDrawing
+	SGL_CAPTURE_IN_FLIGHT, // download submitted, waiting for the fence
+	SGL_CAPTURE_WORKER,	   // mapped, queued for or inside the callback
+	SGL_CAPTURE_DONE,	   // callback returned, unmapped by the next poll
+} SGL_CaptureState;
+
+typedef struct {
+	SDL_AtomicInt state; // SGL_CaptureState, the worker only moves WORKER -> DONE
+	SDL_GPUTransferBuffer* buffer;
+	Uint32 bufferSize;
+	SDL_GPUFence* fence; // shared by the captures of one frame
+	SGL_RenderTexture* target; // NULL = swapchain
+	SGL_CaptureCallback callback;
+	void* userdata;
+	SGL_CaptureFrame frame;
+} SGL_CaptureSlot;
+
+// Matches `uvec4 levels[]` in hiz_build.comp / hiz_cull.comp
+typedef struct {
+	Uint32 offset, width, height, pad;
+} SGL_HiZLevel;
+
 static struct {
 	SDL_GPUDevice* device;
 	SDL_Window* window;
 	SDL_GPUGraphicsPipeline* defaultPipeline;
 	SDL_GPUGraphicsPipeline* activePipeline;
+	SDL_GPUShader* defaultVert;
+	SDL_GPUShader* defaultFrag;
+	SDL_GPUShader* defaultFragMultiply;
 	SDL_GPUBuffer* instanceBuffer;
 	SDL_GPUTransferBuffer* transferBuffer;
-	SGL_InstanceData* mappedPtr;
 	SDL_GPUTexture* swapchainTex;
 	Uint32 instanceCount;
 	SDL_GPUCommandBuffer* curCmd;
@@ -193,17 +643,152 @@ static struct {
 	SDL_GPUTexture* globalTextureArray;
 	SDL_GPUTextureSamplerBinding globalTextureBinding;
 	int nextTextureLayer;
+	int textureLayerCapacity; // allocated layers of globalTextureArray
+	SGL_TextureEntry* textureEntries; // live textures, looked up by path or pixel hash
+	bool textureDedup;
 
 	// --- Free List ---
-	int freeTextureLayers[SGL_MAX_TEXTURES];
+	int* freeTextureLayers; // maxTextures entries
 	int freeTextureCount;
+	bool* opaqueLayers; // maxTextures entries, every texel has alpha 255 (3D opaque pass)
+
+	// --- Limits (SGL_Config) ---
+	int maxInstances;
+	int textureSize;
+	int maxTextures;
+	SDL_GPUTextureFormat depthFormat;
+	Uint32 occlusionCapacity; // visibility slots, opaque 3D instances per frame
 
 	// --- Matrix stuff ---
 	SGL_Matrix currentMatrix;
 	SGL_BatchMode currentMode;
+	SGL_Matrix cameraMatrices[SGL_MAX_BATCH_CAMERAS]; // of the current batch, pushed as one uniform
+	int cameraCount;
+	int cameraIndex; // of currentMatrix, stored in the high bits of every instance type
+
+	// --- Instance Staging ---
+	// Batches are built here in cached CPU memory and streamed into the transfer buffer at
+	// flush. 2D fills it from the bottom, 3D puts opaque at the bottom, translucent at the top.
+	SGL_InstanceData* staging;
+	SGL_SortKey* sortKeys;
+	Uint32 opaqueCount;
+	Uint32 translucentCount;
+	Vec3 viewPos; // camera of sgl_BeginMode3D, for the sort keys
+	Vec3 viewDir;
+
+	// --- Render Textures ---
+	SGL_RenderTexture* renderTarget;   // NULL = swapchain
+	SDL_GPUTexture* renderTargetColor; // textureSize color drawn into, copied to the layer at the end
+	SDL_GPUTexture* renderTargetDepth; // textureSize depth shared by all render textures
+	SGL_Matrix savedMatrix;			   // restored by sgl_EndTextureMode
+	SGL_ViewRect savedView;
+	SGL_BatchMode savedMode;
+	uint32_t textureArrayGeneration; // bumped whenever the array is reallocated
+
+	// --- Occlusion Culling ---
+	bool occlusionEnabled;
+	bool occlusionFailed; // shaders missing, stay off until enabled again
+	bool depthSampled;	  // depthTexture was created with SAMPLER usage
+	SDL_GPUComputePipeline* hizBuildPipeline;
+	SDL_GPUComputePipeline* hizCullPipeline;
+	SDL_GPUSampler* depthSampler;
+	SDL_GPUBuffer* hizPyramid; // all levels packed, farthest depth per texel
+	SGL_HiZLevel hizLevels[SGL_HIZ_MAX_LEVELS];
+	int hizLevelCount;
+	int hizW, hizH; // depth size the pyramid was built for
+	SDL_GPUBuffer* visibleBuffer;	 // instances that passed the test
+	SDL_GPUBuffer* visibilityBuffer; // per-slot result, read back next frame
+	SDL_GPUBuffer* drawArgsBuffer;	 // one indirect draw per phase
+	SDL_GPUTransferBuffer* drawArgsReset;
+	Uint32 occlusionSlot; // first visibility slot of the next batch
+
+	// --- Polylines ---
+	SDL_GPUBuffer* lineBuffer; // header instance + points of one long polyline
+	SDL_GPUTransferBuffer* lineTransfer;
+	Uint32 lineCapacity; // bytes
+
+	// --- Particles ---
+	SDL_GPUComputePipeline* particlePipeline; // shared by all particle systems
+	SDL_GPUTransferBuffer* particleArgsReset; // one indirect draw of 6 vertices, 0 instances
+	bool particleFailed;					  // shader missing, don't retry every create
+
+	// --- View Culling ---
+	bool viewCulling;
+	SGL_ViewRect view; // of the current sgl_BeginMode2D
+
+	// --- Shader Variants ---
+	bool shaderVariantsEnabled;
+	bool shaderVariantsFailed; // shaders missing, stay off until enabled again
+	SDL_GPUShader* variantShaders[SGL_VARIANT_SHADER_COUNT];
+	Uint32 batchFeatures; // SGL_BatchFeature bits of the current batch
+
+	// --- Pipeline Variant Cache ---
+	SGL_PipelineVariant pipelineVariants[SGL_MAX_PIPELINE_VARIANTS];
+	int pipelineVariantCount;
+	SGL_PipelineState pipelineState;
+	SDL_GPUGraphicsPipeline* resolvedPipeline; // activePipeline + pipelineState, NULL = stale
+
+	// --- Frame Pacing ---
+	SDL_GPUPresentMode presentMode;
+	int framesInFlight; // 0 = SDL default
+	bool nonBlockingAcquire;
+	bool frameSkipped;
+	uint64_t framePeriod; // performance counter ticks per frame, 0 = unlimited
+	uint64_t frameMark;	  // end of the previous frame
+	f64 oversleepMeanMs;  // how late SDL_DelayNS wakes up
+	f64 oversleepVarMs;
+
+	// --- Low Power ---
+	bool lowPower;
+	SDL_AtomicInt redrawRequested;
+	Uint32 wakeEvent; // event type pushed by sgl_RequestRedraw, 0 = not registered yet
+
+	// --- Frame Capture ---
+	SGL_CaptureSlot captures[SGL_CAPTURE_RING];
+	SDL_Thread* captureThread;
+	SDL_Mutex* captureLock; // guards the queue and captureQuit
+	SDL_Condition* captureWake;
+	int captureQueue[SGL_CAPTURE_RING]; // slots handed to the worker, oldest first
+	int captureQueueHead;
+	int captureQueueCount;
+	bool captureQuit;
+	Uint32 swapchainW, swapchainH;
+	uint64_t frameCount;
+
+	// --- Frame Stats ---
+	SGL_FrameStats stats;	  // accumulating for the current frame
+	SGL_FrameStats lastStats; // last finished frame
+	SGL_FrameStats statsHistory[SGL_STATS_HISTORY];
+	int statsHistoryHead;
+	int statsHistoryCount;
+	uint64_t frameStartCount;
+	uint32_t frameHistogram[SGL_FRAME_HISTOGRAM_BINS];
 } sgl;
 
 // Window Loop
+static void sgl_HandleEvent(const SDL_Event* e) {
+	if (e->type == SDL_EVENT_QUIT) {
+		sgl.shouldClose = true;
+	} else if (e->type == SDL_EVENT_KEY_DOWN) {
+		if (e->key.key == SDLK_ESCAPE) {
+			sgl.shouldClose = true;
+		}
+	} else if (e->type == SDL_EVENT_MOUSE_WHEEL) {
+		sgl.mouseWheelY += e->wheel.y;
+	}
+
+	// Input, resizes, exposes and sgl_RequestRedraw wake-ups all change what is on screen
+	SDL_SetAtomicInt(&sgl.redrawRequested, 1);
+}
+
+// Minimized, occluded or hidden: nothing drawn would be seen
+static bool sgl_IsWindowHidden(void) {
+	if (!sgl.window)
+		return false;
+	return (SDL_GetWindowFlags(sgl.window) &
+			(SDL_WINDOW_MINIMIZED | SDL_WINDOW_OCCLUDED | SDL_WINDOW_HIDDEN)) != 0;
+}
+
 bool sgl_WindowShouldClose() {
 	if (sgl.shouldClose) {
 		return true;
@@ -211,16 +796,22 @@ bool sgl_WindowShouldClose() {
 
 	sgl.mouseWheelY = 0.0f;
 	SDL_Event e;
-	while (SDL_PollEvent(&e)) {
-		if (e.type == SDL_EVENT_QUIT) {
-			sgl.shouldClose = true;
-		} else if (e.type == SDL_EVENT_KEY_DOWN) {
-			if (e.key.key == SDLK_ESCAPE) {
-				sgl.shouldClose = true;
-			}
-		} else if (e.type == SDL_EVENT_MOUSE_WHEEL) {
-			sgl.mouseWheelY += e.wheel.y;
+	for (;;) {
+		while (SDL_PollEvent(&e)) {
+			sgl_HandleEvent(&e);
 		}
+		if (sgl.shouldClose || !sgl.lowPower)
+			break;
+
+		// Low power: only return when there is a visible frame to draw, sleep in between.
+		// The timeout re-checks the window flags in case a platform sends no restore event.
+		if (!sgl_IsWindowHidden() && SDL_SetAtomicInt(&sgl.redrawRequested, 0))
+			break;
+		SGL_TRACE_BEGIN("sgl_WindowShouldClose.wait");
+		if (SDL_WaitEventTimeout(&e, SGL_LOW_POWER_TIMEOUT_MS)) {
+			sgl_HandleEvent(&e);
+		}
+		SGL_TRACE_END("sgl_WindowShouldClose.wait");
 	}
 
 	sgl.keyboardState = SDL_GetKeyboardState(NULL);
@@ -241,518 +832,1665 @@ f32 sgl_GetMouseWheelY(void) { return sgl.mouseWheelY; }
 
 // uint8 Vertex shader
 const static uint8_t default_vert[] = {
-	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0xef, 0x00, 0x00, 0x00,
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
 	0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
 	0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x0f, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-	0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
-	0x69, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00,
-	0x47, 0x4c, 0x5f, 0x47, 0x4f, 0x4f, 0x47, 0x4c, 0x45, 0x5f, 0x63, 0x70, 0x70, 0x5f, 0x73, 0x74,
-	0x79, 0x6c, 0x65, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-	0x76, 0x65, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x47, 0x4c, 0x5f, 0x47, 0x4f, 0x4f, 0x47, 0x4c,
-	0x45, 0x5f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-	0x69, 0x76, 0x65, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x08, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x74,
-	0x61, 0x6e, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x61,
-	0x6d, 0x73, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x32, 0x00, 0x06, 0x00, 0x05, 0x00, 0x08, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x44, 0x61, 0x74, 0x61,
-	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x72, 0x65, 0x63, 0x74, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x32, 0x00,
-	0x06, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x6c, 0x6f,
-	0x72, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x74,
-	0x61, 0x6e, 0x63, 0x65, 0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
-	0x0f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x00, 0x00, 0x00,
-	0x05, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61,
-	0x6e, 0x63, 0x65, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
-	0x25, 0x00, 0x00, 0x00, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
-	0x34, 0x00, 0x00, 0x00, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x50, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00,
-	0x05, 0x00, 0x06, 0x00, 0x42, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x56, 0x65, 0x72, 0x74, 0x65,
-	0x78, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00,
-	0x69, 0x6e, 0x64, 0x65, 0x78, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00,
-	0x56, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x55, 0x56, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
-	0x64, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00,
-	0x05, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
-	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x69, 0x64, 0x78, 0x00,
-	0x05, 0x00, 0x04, 0x00, 0x75, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x72, 0x6e, 0x65, 0x72, 0x00, 0x00,
-	0x05, 0x00, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00,
-	0xae, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0xb2, 0x00, 0x00, 0x00,
-	0x73, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x54,
-	0x79, 0x70, 0x65, 0x00, 0x05, 0x00, 0x06, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x50,
-	0x65, 0x72, 0x56, 0x65, 0x72, 0x74, 0x65, 0x78, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00,
-	0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74,
-	0x69, 0x6f, 0x6e, 0x00, 0x06, 0x00, 0x07, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x67, 0x6c, 0x5f, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x53, 0x69, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x07, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x43,
-	0x6c, 0x69, 0x70, 0x44, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x00, 0x06, 0x00, 0x07, 0x00,
-	0xd9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x43, 0x75, 0x6c, 0x6c, 0x44,
-	0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x00, 0x05, 0x00, 0x03, 0x00, 0xdb, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x55, 0x6e, 0x69, 0x66,
-	0x6f, 0x72, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x00, 0xdd, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x6d, 0x76, 0x70, 0x00, 0x05, 0x00, 0x03, 0x00, 0xdf, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x54,
-	0x65, 0x78, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x42, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x2a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x69, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-	0x47, 0x00, 0x04, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x47, 0x00, 0x03, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
-	0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x48, 0x00, 0x05, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0xd9, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
-	0xdd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0xdd, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0xdd, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
-	0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x47, 0x00, 0x04, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x47, 0x00, 0x04, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x47, 0x00, 0x03, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
-	0xeb, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x16, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x06, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00,
-	0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
-	0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
-	0x64, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
-	0x33, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
-	0x26, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
-	0x36, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x2b, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x06, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-	0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-	0x38, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-	0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-	0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-	0x37, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
-	0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-	0x37, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x38, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x27, 0x00,
-	0x36, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-	0x39, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-	0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-	0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
-	0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x44, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x46, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
-	0x4a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00,
-	0x56, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
-	0x57, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x58, 0x00, 0x00, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00,
-	0x5b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
-	0x2c, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
-	0x59, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
-	0x59, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x58, 0x00, 0x00, 0x00,
-	0x5f, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
-	0x5d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
-	0x63, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
-	0x65, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
-	0x68, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
-	0x68, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
-	0x6d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x04, 0x00, 0xd4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x1c, 0x00, 0x04, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
-	0x1e, 0x00, 0x06, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xd8, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xda, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xda, 0x00, 0x00, 0x00,
-	0xdb, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0xdc, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0xdd, 0x00, 0x00, 0x00,
-	0xdc, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xde, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0xdd, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xde, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0xdc, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xea, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xea, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x46, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x63, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x65, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x65, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x06, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-	0x11, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
-	0x19, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-	0x1c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-	0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x20, 0x00, 0x00, 0x00,
-	0x1e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-	0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
-	0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x23, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00,
-	0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
-	0x6e, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x25, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
-	0x2e, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
-	0xf7, 0x00, 0x03, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
-	0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x30, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-	0x42, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-	0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x47, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x33, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-	0x47, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
-	0x49, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00,
-	0x49, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
-	0x19, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
-	0x4f, 0x00, 0x08, 0x00, 0x32, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
-	0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-	0x81, 0x00, 0x05, 0x00, 0x32, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
-	0x51, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x34, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-	0x8b, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-	0x61, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x64, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x05, 0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
-	0x62, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
-	0x66, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x56, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-	0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
-	0x6a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x69, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
-	0xf9, 0x00, 0x02, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6c, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
-	0x7c, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x26, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00,
-	0x2e, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
-	0xf7, 0x00, 0x03, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
-	0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x73, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
-	0xf9, 0x00, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x76, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-	0xaa, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00,
-	0x1c, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfa, 0x00, 0x04, 0x00, 0x78, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x02, 0x00, 0x79, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
-	0x7b, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00,
-	0x7c, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
-	0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x7c, 0x00, 0x00, 0x00,
-	0x7d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7d, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x7e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x26, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
-	0x2e, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
-	0xf7, 0x00, 0x03, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
-	0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x84, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
-	0xf9, 0x00, 0x02, 0x00, 0x85, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x85, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x85, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x7e, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x87, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x26, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
-	0x2e, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0xf7, 0x00, 0x03, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
-	0x89, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x8a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00,
-	0xf9, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8c, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
-	0xaa, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
-	0x82, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfa, 0x00, 0x04, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x02, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00,
-	0x5b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x91, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00,
-	0x6e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
-	0x92, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x96, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x94, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00,
-	0x97, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x95, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x75, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x96, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x02, 0x00, 0x97, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00,
-	0x98, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x00, 0x00,
-	0x99, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
-	0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x99, 0x00, 0x00, 0x00,
-	0x9a, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9a, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x9b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x26, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
-	0x2e, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
-	0xf7, 0x00, 0x03, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
-	0x9f, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0xa0, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
-	0xf9, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa2, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x75, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x9b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x96, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x96, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x90, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x8b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x7a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x74, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x74, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x56, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00,
-	0xa5, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
-	0xa6, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00,
-	0xa9, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
-	0x19, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00,
-	0x4f, 0x00, 0x07, 0x00, 0x54, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
-	0xab, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
-	0x28, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-	0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00,
-	0xaf, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0xae, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00,
-	0xb3, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
-	0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x0d, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xb2, 0x00, 0x00, 0x00,
-	0xb5, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
-	0xb7, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x54, 0x00, 0x00, 0x00,
-	0xb8, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
-	0xa4, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xba, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xbb, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xbc, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
-	0x28, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
-	0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
-	0xbf, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
-	0xbc, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00,
-	0xc2, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
-	0x82, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
-	0xc6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00,
-	0xae, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00,
-	0xc7, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xca, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
-	0x54, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00,
-	0x81, 0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
-	0xcb, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x32, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
-	0xcf, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x34, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00,
-	0xd2, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x69, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x31, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x02, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0xd6, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xd7, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xd5, 0x00, 0x00, 0x00,
-	0xd7, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
-	0xdf, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0xdc, 0x00, 0x00, 0x00,
-	0xe2, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00,
-	0xe3, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0xe4, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
-	0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00,
-	0xe4, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
-	0x91, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00,
-	0xe7, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x68, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
-	0xdb, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe9, 0x00, 0x00, 0x00,
-	0xe8, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
-	0x10, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0xeb, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+	0x0f, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xc2, 0x01, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x3b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x06, 0x00, 0x25, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x02, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x55, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x59, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x5b, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x27, 0x00, 0x52, 0x00, 0x00, 0x00,
+	0x5d, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+	0x5a, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+	0x59, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x59, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+	0x5a, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x55, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+	0x5a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x52, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+	0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+	0x62, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x61, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x64, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x67, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x6b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x73, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x78, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x91, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0x96, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x66, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0xa7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+	0xb7, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0xde, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+	0x65, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x5e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+	0x69, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x7d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+	0x7e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0x9c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0xd5, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+	0xdc, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x6a, 0x00, 0x00, 0x00,
+	0xdf, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0xea, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x05, 0x00, 0x32, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x32, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x38, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+	0x39, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x4a, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x5e, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x69, 0x00, 0x00, 0x00,
+	0x68, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x6d, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x8e, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+	0x6f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x47, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x72, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0x75, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x7b, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x79, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+	0x7c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x7d, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x7e, 0x00, 0x00, 0x00,
+	0x68, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x81, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x48, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+	0x7d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x86, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x81, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00,
+	0x86, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x47, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x47, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+	0x87, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x8b, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x8c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x76, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+	0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x7c, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00,
+	0x92, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+	0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x92, 0x00, 0x00, 0x00,
+	0x93, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x93, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x97, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x6e, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+	0x87, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+	0x73, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0xad, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00,
+	0x99, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xa1, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00,
+	0xa2, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+	0x84, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+	0xa4, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa7, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xa2, 0x00, 0x00, 0x00, 0xad, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00,
+	0xad, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+	0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xad, 0x00, 0x00, 0x00,
+	0xae, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xae, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xaf, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+	0xb2, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xb6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+	0xba, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+	0xb7, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00,
+	0xb6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0xba, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0xbe, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+	0xa9, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+	0xba, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0xc0, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x76, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00,
+	0x7f, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
+	0x81, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+	0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xc6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+	0xc4, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xc7, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xc8, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0xc7, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+	0xcb, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+	0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0xce, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+	0x81, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+	0xcf, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00,
+	0xce, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0xd2, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x46, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00,
+	0xb6, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0xd4, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x95, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0xae, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00,
+	0xd6, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xd9, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00,
+	0xda, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0xd5, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd9, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xda, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xdc, 0x00, 0x00, 0x00,
+	0x96, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00,
+	0xaa, 0x00, 0x05, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0xe4, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0xd5, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xe2, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x76, 0x00, 0x00, 0x00,
+	0xe6, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0xd5, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xe2, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xe2, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd9, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0xe8, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0xe8, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0xea, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x4d, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0xeb, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0xec, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+	0xee, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0xea, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xed, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xed, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0xf1, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0xfc, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x00, 0x00, 0xfb, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+	0xf3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x81, 0x00, 0x05, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+	0x03, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x06, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x05, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x94, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x94, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x7b, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x4f, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x47, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+	0xbb, 0x00, 0x00, 0x00, 0x91, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00,
+	0x0b, 0x01, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x0b, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x0c, 0x01, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
 };
 
 // Fragment Shader
 // Uint8
 const static uint8_t default_frag[] = {
-	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x44, 0x00, 0x00, 0x00,
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c,
+	0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+	0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x7d, 0x00, 0x00, 0x00, 0xac, 0xc5, 0x27, 0x37, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x99, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xa5, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xaa, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x43, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xbc, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xdc, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xe0, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x33, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x37, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x3b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+	0x49, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x4a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x52, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x58, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x56, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x5e, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+	0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x6f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+	0x62, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+	0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x75, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+	0x76, 0x00, 0x00, 0x00, 0xba, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0x74, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x79, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+	0x64, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x33, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x7f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x84, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x87, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x8a, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x8d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x90, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x94, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x99, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x9b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0x85, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x9f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
+	0xa5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x64, 0x00, 0x04, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0xaa, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+	0xa9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0xae, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0xb2, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb1, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+	0xb3, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xb6, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+	0xb9, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xbb, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xbd, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+	0x67, 0x00, 0x05, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+	0xab, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xc1, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xc2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+	0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+	0x8b, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+	0xc4, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+	0xc5, 0x00, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+	0xbe, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xc8, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0xc9, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00,
+	0xca, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+	0xcd, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+	0xcb, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0xd0, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x99, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0xd4, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xb0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xa0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0xd8, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0xd9, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0xde, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+	0xdd, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+	0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x99, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+	0xe4, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+	0xe9, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0xda, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xdb, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xda, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xda, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00,
+	0x99, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+	0xef, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+	0xed, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0xf1, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0xa0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x85, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x85, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+
+// Fragment Shader for SGL_BLEND_MULTIPLY: the same, with premultiplied color output
+// Uint8
+const static uint8_t default_frag_multiply[] = {
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c,
+	0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x03, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f,
+	0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x7d, 0x00, 0x00, 0x00, 0xac, 0xc5, 0x27, 0x37, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x99, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x9d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xa5, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xaa, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x43, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xbc, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xdc, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xe0, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+	0xa6, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x33, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x37, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x3a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x3b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+	0x49, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x4e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x4a, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00,
+	0x52, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x53, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x57, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x58, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x56, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x5b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x5e, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x55, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00,
+	0x69, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x6c, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x6f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00,
+	0x62, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00,
+	0x72, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x75, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
+	0x76, 0x00, 0x00, 0x00, 0xba, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+	0x74, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x79, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00,
+	0x64, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x33, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x7f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0x82, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x84, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x87, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x8a, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x8d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x90, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x93, 0x00, 0x00, 0x00,
+	0x83, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x94, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x99, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00,
+	0x97, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x9b, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0x85, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x86, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x9d, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x9e, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x9f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
+	0xa5, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x64, 0x00, 0x04, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00,
+	0xaa, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00,
+	0x5f, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+	0xa9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfa, 0x00, 0x04, 0x00, 0xae, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0xb2, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb1, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00,
+	0xb3, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xb6, 0x00, 0x00, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00,
+	0xb4, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00,
+	0xb9, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xbb, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0xbd, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
+	0x67, 0x00, 0x05, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00,
+	0xab, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xc1, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xc2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+	0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+	0x8b, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00,
+	0xc4, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00,
+	0xc5, 0x00, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00,
+	0xbe, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0xc8, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0xc9, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcb, 0x00, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00,
+	0xca, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
+	0xcd, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00,
+	0xcb, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0xd0, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0xcf, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x99, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00,
+	0xd1, 0x00, 0x00, 0x00, 0xd2, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0xd4, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xd3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xd5, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xb0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xa0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0xab, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0xd8, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0xd9, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x22, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0xde, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+	0xdd, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+	0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x99, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+	0xe4, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+	0xe9, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00,
+	0xf9, 0x00, 0x02, 0x00, 0xda, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xdb, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
+	0xda, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xda, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00,
+	0x99, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xee, 0x00, 0x00, 0x00,
+	0xef, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00,
+	0xed, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0xf1, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa0, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0xa0, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x85, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x85, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x99, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00,
+	0xf2, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+	0xf2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x99, 0x00, 0x00, 0x00,
+	0xf5, 0x00, 0x00, 0x00, 0xf3, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00,
+	0xf6, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00,
+	0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+
+// Shader variants (see sgl_SetShaderVariants), from shaders/variant.vert and variant.frag
+// Uint8
+const static uint8_t variant_quad_vert[] = {
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
 	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
 	0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
 	0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x0f, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
-	0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
-	0x3c, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00,
-	0x04, 0x00, 0x0a, 0x00, 0x47, 0x4c, 0x5f, 0x47, 0x4f, 0x4f, 0x47, 0x4c, 0x45, 0x5f, 0x63, 0x70,
-	0x70, 0x5f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x64, 0x69, 0x72,
-	0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x47, 0x4c, 0x5f, 0x47,
-	0x4f, 0x4f, 0x47, 0x4c, 0x45, 0x5f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5f, 0x64, 0x69,
-	0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00,
-	0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00,
-	0x69, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x16, 0x00, 0x00, 0x00,
-	0x69, 0x6e, 0x55, 0x56, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x21, 0x00, 0x00, 0x00,
-	0x69, 0x6e, 0x54, 0x65, 0x78, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00,
-	0x29, 0x00, 0x00, 0x00, 0x74, 0x65, 0x78, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00,
-	0x05, 0x00, 0x06, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x54, 0x65,
-	0x78, 0x74, 0x75, 0x72, 0x65, 0x73, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00,
-	0x6f, 0x75, 0x74, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00,
-	0x05, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x69, 0x6e, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x00,
-	0x47, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x3b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x06, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x37, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x3d, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x52, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x36, 0x00, 0x05, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x29, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x91, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x58, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x55, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+
+// -DROTATED
+const static uint8_t variant_quad_rotated_vert[] = {
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x3b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x06, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x37, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x3d, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+	0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x61, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x36, 0x00, 0x05, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x23, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x25, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x29, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x35, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0x39, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x52, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x56, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00,
+	0x4d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x5a, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00,
+	0x5b, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x81, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x63, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x66, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x91, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x64, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+	0x38, 0x00, 0x01, 0x00
+};
+
+// -DCUBE
+const static uint8_t variant_cube_vert[] = {
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
 	0x16, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
-	0x21, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x00,
-	0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00,
-	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00,
-	0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, 0x00,
-	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, 0x00,
-	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00,
-	0x09, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-	0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-	0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x17, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-	0x20, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x17, 0x00, 0x04, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0x19, 0x00, 0x09, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x15, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x2b, 0x00, 0x04, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x17, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-	0x20, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-	0x3b, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-	0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
-	0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
-	0x28, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00,
-	0x06, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x08, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
-	0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00,
-	0x11, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00,
-	0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
-	0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-	0x50, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-	0x17, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x09, 0x00, 0x00, 0x00,
-	0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-	0xba, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-	0x18, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-	0xfa, 0x00, 0x04, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x02, 0x00, 0x1d, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x01, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x1e, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x13, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
-	0x13, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-	0x21, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-	0x22, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x26, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
-	0x42, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x2b, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
-	0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-	0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-	0x41, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-	0x33, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
-	0x34, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
-	0x21, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
-	0x36, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x38, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-	0x32, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00,
-	0x27, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x27, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x27, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00,
-	0x27, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-	0x3e, 0x00, 0x03, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00,
-	0x26, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x42, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
-	0x27, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
-	0x3c, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x26, 0x00, 0x00, 0x00,
-	0xf8, 0x00, 0x02, 0x00, 0x26, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+	0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x3b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x03, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00,
+	0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x12, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x06, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+	0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x37, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+	0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x47, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x06, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x27, 0x00, 0x3e, 0x00, 0x00, 0x00,
+	0x49, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
+	0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x45, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+	0x46, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x4c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+	0x4e, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x51, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
+	0x4e, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x50, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00,
+	0x53, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x58, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x5e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x36, 0x00, 0x05, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x28, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00,
+	0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00,
+	0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+	0x2c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+	0x2d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00,
+	0x33, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6e, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
+	0xc3, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+	0x37, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x4a, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00,
+	0x54, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x58, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00,
+	0x4a, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, 0x00,
+	0x59, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x5a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00,
+	0x3c, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00,
+	0x4f, 0x00, 0x08, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+	0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x81, 0x00, 0x05, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x00, 0x00,
+	0x5c, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, 0x00, 0x11, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x61, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x16, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00,
+	0x34, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00,
+	0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00,
+	0x64, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x64, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x15, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x67, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x91, 0x00, 0x05, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00,
+	0x3e, 0x00, 0x03, 0x00, 0x65, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00,
+	0x38, 0x00, 0x01, 0x00
+};
+
+const static uint8_t variant_solid_frag[] = {
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00,
+	0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
+	0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
+};
+
+// -DTEXTURED
+const static uint8_t variant_textured_frag[] = {
+	0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, 0x30,
+	0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0f, 0x00, 0x09, 0x00, 0x04, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e,
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x03, 0x00, 0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x12, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x19, 0x00, 0x00, 0x00,
+	0x17, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x36, 0x00, 0x05, 0x00, 0x12, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x13, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00,
+	0x19, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+	0xf7, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x1a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+	0x06, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
+	0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x1f, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00,
+	0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
+	0x21, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x57, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+	0x24, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x27, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00,
+	0x10, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00,
+	0xf8, 0x00, 0x02, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00,
+	0x1b, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00
 };
 
 // --- Helper Functions ---
@@ -806,8 +2544,10 @@ sgl_LogOutputFunction(void* userdata, int category, SDL_LogPriority priority, co
 }
 
 static void sgl_SetViewport(SDL_GPURenderPass* pass) {
-	int physW, physH;
-	SDL_GetWindowSizeInPixels(sgl.window, &physW, &physH);
+	int physW = sgl.textureSize;
+	int physH = sgl.textureSize;
+	if (!sgl.renderTarget)
+		SDL_GetWindowSizeInPixels(sgl.window, &physW, &physH);
 
 	SDL_GPUViewport viewport = {
 		.x = 0,
@@ -827,9 +2567,11 @@ static void sgl_CheckResize(void) {
 	int w, h;
 	SDL_GetWindowSizeInPixels(sgl.window, &w, &h);
 
-	if (sgl.depthTexture == NULL || w != sgl.winW || h != sgl.winH) {
+	bool needSampled = sgl.occlusionEnabled && !sgl.depthSampled;
+	if (sgl.depthTexture == NULL || w != sgl.winW || h != sgl.winH || needSampled) {
 		sgl.winW = w;
 		sgl.winH = h;
+		sgl.depthSampled = sgl.depthSampled || sgl.occlusionEnabled;
 
 		if (sgl.depthTexture) {
 			SDL_ReleaseGPUTexture(sgl.device, sgl.depthTexture);
@@ -837,12 +2579,13 @@ static void sgl_CheckResize(void) {
 
 		SDL_GPUTextureCreateInfo depthInfo = {
 			.type = SDL_GPU_TEXTURETYPE_2D,
-			.format = SDL_GPU_TEXTUREFORMAT_D16_UNORM,
+			.format = sgl.depthFormat,
 			.width = (uint32_t)w,
 			.height = (uint32_t)h,
 			.layer_count_or_depth = 1,
 			.num_levels = 1,
-			.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET,
+			.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET |
+					 (sgl.depthSampled ? SDL_GPU_TEXTUREUSAGE_SAMPLER : 0),
 		};
 		sgl.depthTexture = SDL_CreateGPUTexture(sgl.device, &depthInfo);
 	}
@@ -879,136 +2622,808 @@ static SDL_GPUShader* sgl_CreateShaderFromBytes(
 	return shaderCreate;
 }
 
-// internal flush
-static void sgl_Flush(void) {
-	if (sgl.instanceCount == 0)
+static f64 sgl_PerfToMs(uint64_t delta) {
+	return (f64)delta * 1000.0 / (f64)SDL_GetPerformanceFrequency();
+}
+
+static SDL_GPUGraphicsPipeline* sgl_ResolvePipeline(void); // see Shader API
+static SGL_PipelineState sgl_CurrentPipelineState(void);
+static SGL_PipelineState sgl_SoftEdgeState(SGL_PipelineState state);
+static SDL_GPUGraphicsPipeline* sgl_PipelineForState(SGL_PipelineState state);
+static SDL_GPUGraphicsPipeline*
+sgl_SpecializePipeline(SDL_GPUGraphicsPipeline* pipeline, SGL_PipelineState state);
+
+static int sgl_CompareSortKeyAsc(const void* a, const void* b) {
+	f32 x = ((const SGL_SortKey*)a)->depth;
+	f32 y = ((const SGL_SortKey*)b)->depth;
+	return (x > y) - (x < y);
+}
+
+static int sgl_CompareSortKeyDesc(const void* a, const void* b) {
+	return sgl_CompareSortKeyAsc(b, a);
+}
+
+// Copy a batch into mapped transfer memory, which is often write-combined: whole 16-byte
+// streaming stores that bypass the cache, never reads or partial writes.
+static void sgl_StreamCopy(void* dst, const void* src, size_t bytes) {
+#ifdef SDL_SSE2_INTRINSICS
+	if ((((uintptr_t)dst | (uintptr_t)src) & 15) == 0) {
+		__m128i* d = (__m128i*)dst;
+		const __m128i* s = (const __m128i*)src;
+		size_t n = bytes / 16;
+		for (size_t i = 0; i < n; i++)
+			_mm_stream_si128(d + i, _mm_load_si128(s + i));
+		_mm_sfence();
+		SDL_memcpy(d + n, s + n, bytes % 16);
 		return;
+	}
+#endif
+	SDL_memcpy(dst, src, bytes);
+}
 
-	SDL_UnmapGPUTransferBuffer(sgl.device, sgl.transferBuffer);
+// Write the staged 3D instances into the transfer buffer: opaque front-to-back, then
+// translucent back-to-front. With occlusion culling opaque stays in submission order,
+// so visibility slots keep following the same instance from frame to frame. The staging array holds opaque from the bottom and
+// translucent from the top.
+static void sgl_GatherSorted3D(SGL_InstanceData* dst, bool sortOpaque) {
+	SGL_SortKey* opaqueKeys = sgl.sortKeys;
+	SGL_SortKey* translucentKeys = sgl.sortKeys + (sgl.maxInstances - sgl.translucentCount);
+
+	if (sortOpaque)
+		SDL_qsort(opaqueKeys, sgl.opaqueCount, sizeof(SGL_SortKey), sgl_CompareSortKeyAsc);
+	SDL_qsort(translucentKeys, sgl.translucentCount, sizeof(SGL_SortKey), sgl_CompareSortKeyDesc);
+
+	for (Uint32 i = 0; i < sgl.opaqueCount; i++)
+		*dst++ = sgl.staging[opaqueKeys[i].index];
+	for (Uint32 i = 0; i < sgl.translucentCount; i++)
+		*dst++ = sgl.staging[translucentKeys[i].index];
+}
+
+// Open a render pass on the swapchain with everything the default shaders expect bound.
+// `matrix` NULL binds the camera table of the batch, otherwise a table of just `matrix`.
+// Returns NULL when there is nothing to draw into.
+static SDL_GPURenderPass* sgl_BeginScenePass(
+	SDL_GPUGraphicsPipeline* pipeline,
+	const SGL_Matrix* matrix,
+	SDL_GPUBuffer* instances
+) {
+	// Render Pass (Reuse the texture we acquired in BeginDrawing)
+	// Note: We use LOAD_OP_LOAD because we want to draw ON TOP of what's already there.
+	SDL_GPUTexture* color = sgl.swapchainTex;
+	SDL_GPUTexture* depth = sgl.depthTexture;
+	if (sgl.renderTarget) {
+		color = sgl.renderTargetColor;
+		depth = sgl.renderTargetDepth;
+	}
+	if (!color || !depth)
+		return NULL;
+
+	SGL_TRACE_BEGIN("sgl_Flush.renderPass");
+	SDL_GPUColorTargetInfo colorTargetInfo = {
+		.texture = color,
+		.load_op = SDL_GPU_LOADOP_LOAD, // <--- Keep previous draw calls
+		.store_op = SDL_GPU_STOREOP_STORE,
+	};
+
+	SDL_GPUDepthStencilTargetInfo depthTargetInfo = {
+		.texture = depth,
+		.load_op = SDL_GPU_LOADOP_LOAD, // <--- Keep previous depth info
+		.store_op = SDL_GPU_STOREOP_STORE,
+		.cycle = false,
+	};
+
+	SDL_GPURenderPass* pass =
+		SDL_BeginGPURenderPass(sgl.curCmd, &colorTargetInfo, 1, &depthTargetInfo);
+
+	SDL_BindGPUGraphicsPipeline(pass, pipeline);
+	sgl_SetViewport(pass);
+
+	// Bind Textures
+	SDL_BindGPUFragmentSamplers(pass, 0, &sgl.globalTextureBinding, 1);
+
+	// Upload Matrix Uniforms (Using correct Slot 0), always the full table the shaders declare
+	if (matrix) {
+		SGL_Matrix table[SGL_MAX_BATCH_CAMERAS] = { *matrix };
+		SDL_PushGPUVertexUniformData(sgl.curCmd, 0, table, sizeof(table));
+	} else {
+		SDL_PushGPUVertexUniformData(sgl.curCmd, 0, sgl.cameraMatrices, sizeof(sgl.cameraMatrices));
+	}
+
+	// Bind Instance Data Storage Buffer (Set 1, Binding 0 -> Slot 0)
+	SDL_GPUBuffer* bufs[] = { instances };
+	SDL_BindGPUVertexStorageBuffers(pass, 0, bufs, 1);
+	return pass;
+}
+
+static void sgl_EndScenePass(SDL_GPURenderPass* pass) {
+	SDL_EndGPURenderPass(pass);
+	sgl.stats.renderPasses++;
+	sgl.stats.drawCalls++;
+	SGL_TRACE_END("sgl_Flush.renderPass");
+}
+
+// Draw `count` instances from a storage buffer into the swapchain.
+// Also used by retained draws (voxel chunks) that own their instance buffer.
+static void sgl_DrawInstances(
+	SDL_GPUBuffer* buffer,
+	Uint32 vertCount,
+	Uint32 count,
+	SDL_GPUGraphicsPipeline* pipeline,
+	const SGL_Matrix* matrix
+) {
+	SDL_GPURenderPass* pass = sgl_BeginScenePass(pipeline, matrix, buffer);
+	if (!pass)
+		return;
+
+	// Draw!
+	SDL_DrawGPUPrimitives(pass, vertCount, count, 0, 0);
+	sgl_EndScenePass(pass);
+}
+
+// Upload `count` instances starting at `first` in the transfer buffer and draw them.
+// The range always lands at offset 0 of the storage buffer because first_instance
+// is not portable with gl_InstanceIndex.
+static void sgl_DrawBatch(Uint32 first, Uint32 count, SDL_GPUGraphicsPipeline* pipeline) {
+	if (count == 0)
+		return;
 
 	// Upload CPU Transfer Buffer -> GPU Storage Buffer
 	SDL_GPUTransferBufferLocation src = {
 		.transfer_buffer = sgl.transferBuffer,
-		.offset = 0,
+		.offset = (Uint32)(first * sizeof(SGL_InstanceData)),
 	};
 	SDL_GPUBufferRegion dst = {
 		.buffer = sgl.instanceBuffer,
 		.offset = 0,
-		.size = (Uint32)(sgl.instanceCount * sizeof(SGL_InstanceData)),
+		.size = (Uint32)(count * sizeof(SGL_InstanceData)),
 	};
 
+	SGL_TRACE_BEGIN("sgl_Flush.copyPass");
 	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(sgl.curCmd);
 	SDL_UploadToGPUBuffer(copy, &src, &dst, true);
 	SDL_EndGPUCopyPass(copy);
+	SGL_TRACE_END("sgl_Flush.copyPass");
 
-	// Render Pass (Reuse the texture we acquired in BeginDrawing)
-	// Note: We use LOAD_OP_LOAD because we want to draw ON TOP of what's already there.
-	if (sgl.swapchainTex && sgl.depthTexture) {
-		SDL_GPUColorTargetInfo colorTargetInfo = {
-			.texture = sgl.swapchainTex,
-			.load_op = SDL_GPU_LOADOP_LOAD, // <--- Keep previous draw calls
-			.store_op = SDL_GPU_STOREOP_STORE,
-		};
+	// Determine Vertex Count based on Mode
+	// 2D = 6 vertices (1 Quad), 3D = 36 vertices (1 Cube)
+	Uint32 vertCount = (sgl.currentMode == SGL_BATCH_2D) ? 6 : 36;
+	sgl_DrawInstances(sgl.instanceBuffer, vertCount, count, pipeline, NULL);
+}
 
-		SDL_GPUDepthStencilTargetInfo depthTargetInfo = {
-			.texture = sgl.depthTexture,
-			.load_op = SDL_GPU_LOADOP_LOAD, // <--- Keep previous depth info
-			.store_op = SDL_GPU_STOREOP_STORE,
-			.cycle = false,
-		};
+// --- Occlusion Culling ---
+// Two phases per 3D batch: draw what was visible last frame, build a depth pyramid
+// from the result, then test everything else against it and draw the survivors.
+// Both draws are indirect, the CPU never learns how many instances passed.
 
-		SDL_GPURenderPass* pass =
-			SDL_BeginGPURenderPass(sgl.curCmd, &colorTargetInfo, 1, &depthTargetInfo);
+// Uniforms of hiz_build.comp (src.pad = 1 reads the depth buffer)
+typedef struct {
+	SGL_HiZLevel src;
+	SGL_HiZLevel dst;
+} SGL_HiZBuildParams;
 
-		SDL_BindGPUGraphicsPipeline(pass, sgl.activePipeline);
-		sgl_SetViewport(pass);
+// Uniforms of hiz_cull.comp
+typedef struct {
+	SGL_Matrix viewProj;
+	Uint32 count, firstSlot, phase, levelCount;
+	SGL_HiZLevel levels[SGL_HIZ_MAX_LEVELS];
+} SGL_HiZCullParams;
 
-		// Bind Textures
-		SDL_BindGPUFragmentSamplers(pass, 0, &sgl.globalTextureBinding, 1);
+static SDL_GPUComputePipeline* sgl_LoadComputePipeline(
+	const char* filename,
+	SDL_GPUComputePipelineCreateInfo info
+) {
+	size_t codeSize;
+	void* code = SDL_LoadFile(filename, &codeSize);
+	if (!code) {
+		SGL_Error("Compute shader file not found: %s", filename);
+		return NULL;
+	}
 
-		// Upload Matrix Uniforms (Using correct Slot 0)
-		SDL_PushGPUVertexUniformData(sgl.curCmd, 0, &sgl.currentMatrix, sizeof(SGL_Matrix));
+	info.code_size = codeSize;
+	info.code = (const Uint8*)code;
+	info.entrypoint = "main";
+	info.format = SDL_GPU_SHADERFORMAT_SPIRV;
 
-		// Bind Instance Data Storage Buffer (Set 1, Binding 0 -> Slot 0)
-		SDL_GPUBuffer* bufs[] = { sgl.instanceBuffer };
-		SDL_BindGPUVertexStorageBuffers(pass, 0, bufs, 1);
+	SDL_GPUComputePipeline* pipeline = SDL_CreateGPUComputePipeline(sgl.device, &info);
+	SDL_free(code);
 
-		// Determine Vertex Count based on Mode
-		// 2D = 6 vertices (1 Quad), 3D = 36 vertices (1 Cube)
-		int32_t vertCount = (sgl.currentMode == SGL_BATCH_2D) ? 6 : 36;
+	if (!pipeline)
+		SGL_Error("Failed to create compute pipeline %s: %s", filename, SDL_GetError());
+	return pipeline;
+}
 
-		// Draw!
-		SDL_DrawGPUPrimitives(pass, vertCount, sgl.instanceCount, 0, 0);
+static void sgl_ReleaseOcclusionResources(void) {
+	if (sgl.hizBuildPipeline)
+		SDL_ReleaseGPUComputePipeline(sgl.device, sgl.hizBuildPipeline);
+	if (sgl.hizCullPipeline)
+		SDL_ReleaseGPUComputePipeline(sgl.device, sgl.hizCullPipeline);
+	if (sgl.depthSampler)
+		SDL_ReleaseGPUSampler(sgl.device, sgl.depthSampler);
+	if (sgl.hizPyramid)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.hizPyramid);
+	if (sgl.visibleBuffer)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.visibleBuffer);
+	if (sgl.visibilityBuffer)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.visibilityBuffer);
+	if (sgl.drawArgsBuffer)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.drawArgsBuffer);
+	if (sgl.drawArgsReset)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.drawArgsReset);
+
+	sgl.hizBuildPipeline = NULL;
+	sgl.hizCullPipeline = NULL;
+	sgl.depthSampler = NULL;
+	sgl.hizPyramid = NULL;
+	sgl.visibleBuffer = NULL;
+	sgl.visibilityBuffer = NULL;
+	sgl.drawArgsBuffer = NULL;
+	sgl.drawArgsReset = NULL;
+	sgl.hizW = 0;
+	sgl.hizH = 0;
+}
 
-		SDL_EndGPURenderPass(pass);
-	}
+static bool sgl_CreateOcclusionResources(void) {
+	if (sgl.hizCullPipeline)
+		return true;
 
-	// RESET STATE FOR NEXT BATCH
-	sgl.instanceCount = 0;
+	sgl.hizBuildPipeline = sgl_LoadComputePipeline(
+		SGL_SHADER_DIR "hiz_build.comp.spv",
+		(SDL_GPUComputePipelineCreateInfo){
+			.num_samplers = 1,
+			.num_readwrite_storage_buffers = 1,
+			.num_uniform_buffers = 1,
+			.threadcount_x = 8,
+			.threadcount_y = 8,
+			.threadcount_z = 1,
+		}
+	);
+	sgl.hizCullPipeline = sgl_LoadComputePipeline(
+		SGL_SHADER_DIR "hiz_cull.comp.spv",
+		(SDL_GPUComputePipelineCreateInfo){
+			.num_readonly_storage_buffers = 2,
+			.num_readwrite_storage_buffers = 3,
+			.num_uniform_buffers = 1,
+			.threadcount_x = 64,
+			.threadcount_y = 1,
+			.threadcount_z = 1,
+		}
+	);
 
-	void* newPtr =
-		(SGL_InstanceData*)SDL_MapGPUTransferBuffer(sgl.device, sgl.transferBuffer, true);
+	SDL_GPUSamplerCreateInfo samplerInfo = {
+		.min_filter = SDL_GPU_FILTER_NEAREST,
+		.mag_filter = SDL_GPU_FILTER_NEAREST,
+		.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+	};
+	sgl.depthSampler = SDL_CreateGPUSampler(sgl.device, &samplerInfo);
 
-	if (newPtr == NULL) {
-		SGL_Error("Failed to remap transfer buffer in Flush! GPU might be lost.");
-		sgl.mappedPtr = NULL;
-		return;
+	SDL_GPUBufferCreateInfo visibleInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = sgl.maxInstances * sizeof(SGL_InstanceData),
+	};
+	sgl.visibleBuffer = SDL_CreateGPUBuffer(sgl.device, &visibleInfo);
+
+	SDL_GPUBufferCreateInfo visibilityInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = sgl.occlusionCapacity * sizeof(Uint32),
+	};
+	sgl.visibilityBuffer = SDL_CreateGPUBuffer(sgl.device, &visibilityInfo);
+
+	SDL_GPUBufferCreateInfo argsInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+				 SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = 2 * sizeof(SDL_GPUIndirectDrawCommand),
+	};
+	sgl.drawArgsBuffer = SDL_CreateGPUBuffer(sgl.device, &argsInfo);
+
+	// Uploaded before every batch: 36 vertices (one cube), 0 instances, per phase.
+	// Sized to also zero the visibility buffer once below.
+	SDL_GPUTransferBufferCreateInfo resetInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = sgl.occlusionCapacity * sizeof(Uint32),
+	};
+	sgl.drawArgsReset = SDL_CreateGPUTransferBuffer(sgl.device, &resetInfo);
+
+	if (!sgl.hizBuildPipeline || !sgl.hizCullPipeline || !sgl.depthSampler || !sgl.visibleBuffer ||
+		!sgl.visibilityBuffer || !sgl.drawArgsBuffer || !sgl.drawArgsReset) {
+		sgl_ReleaseOcclusionResources();
+		return false;
 	}
 
-	sgl.mappedPtr = (SGL_InstanceData*)newPtr;
+	// Nothing was visible "last frame"
+	Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, sgl.drawArgsReset, false);
+	SDL_memset(map, 0, resetInfo.size);
+	SDL_UnmapGPUTransferBuffer(sgl.device, sgl.drawArgsReset);
+
+	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(cmd);
+	SDL_GPUTransferBufferLocation src = { .transfer_buffer = sgl.drawArgsReset, .offset = 0 };
+	SDL_GPUBufferRegion dst = { .buffer = sgl.visibilityBuffer, .offset = 0, .size = resetInfo.size };
+	SDL_UploadToGPUBuffer(copy, &src, &dst, false);
+	SDL_EndGPUCopyPass(copy);
+	SDL_SubmitGPUCommandBuffer(cmd);
+
+	SDL_GPUIndirectDrawCommand reset[2] = { { 36, 0, 0, 0 }, { 36, 0, 0, 0 } };
+	map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, sgl.drawArgsReset, true);
+	SDL_memcpy(map, reset, sizeof(reset));
+	SDL_UnmapGPUTransferBuffer(sgl.device, sgl.drawArgsReset);
+
+	SGL_Log("Hi-Z occlusion culling ready");
+	return true;
 }
 
-static void sgl_PushInstance(
-	f32 x,
-	f32 y,
-	f32 w,
-	f32 h,
-	f32 angle,
-	f32 ox,
-	f32 oy,
-	f32 z,
-	int type,
-	SGL_COLOR color
-) {
-	if (sgl.instanceCount >= SGL_MAX_INSTANCES) {
-		sgl_Flush();
+static bool sgl_OcclusionReady(void) {
+	if (!sgl.occlusionEnabled || sgl.occlusionFailed)
+		return false;
+	if (!sgl_CreateOcclusionResources()) {
+		SGL_Warn("Occlusion culling disabled, shaders in %s could not be loaded", SGL_SHADER_DIR);
+		sgl.occlusionFailed = true;
+		return false;
 	}
+	return true;
+}
 
-	if (!sgl.mappedPtr) {
-		SGL_Error("preventing writing to NULL cause flush is failed %s", SDL_GetError());
-		return;
+// Pyramid level 0 is half the depth buffer, every level halves again down to 1x1
+static bool sgl_PrepareDepthPyramid(void) {
+	if (sgl.hizPyramid && sgl.hizW == sgl.winW && sgl.hizH == sgl.winH)
+		return true;
+
+	if (sgl.hizPyramid) {
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.hizPyramid);
+		sgl.hizPyramid = NULL;
 	}
 
-	// Now safe to write because Flush() reset instanceCount and remapped the pointer
-	sgl.mappedPtr[sgl.instanceCount++] = (SGL_InstanceData){
-		.x = x,
-		.y = y,
-		.w = w,
-		.h = h,
-		.angle = angle,
-		.ox = ox,
-		.oy = oy,
-		.z = z,
-		.type = (f32)type,
-		// .texIndex = 0,
-		.texIndex = -1.0f,
-		.p2 = 0,
-		.p3 = 0,
-		.r = color.r / 255.0f,
-		.g = color.g / 255.0f,
-		.b = color.b / 255.0f,
-		.a = color.a / 255.0f,
+	Uint32 w = SDL_max(1, sgl.winW / 2);
+	Uint32 h = SDL_max(1, sgl.winH / 2);
+	Uint32 offset = 0;
+	int count = 0;
+	while (count < SGL_HIZ_MAX_LEVELS) {
+		sgl.hizLevels[count++] = (SGL_HiZLevel){ offset, w, h, 0 };
+		offset += w * h;
+		if (w == 1 && h == 1)
+			break;
+		w = SDL_max(1, w / 2);
+		h = SDL_max(1, h / 2);
+	}
+	sgl.hizLevelCount = count;
+
+	SDL_GPUBufferCreateInfo info = {
+		.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = offset * sizeof(f32),
 	};
+	sgl.hizPyramid = SDL_CreateGPUBuffer(sgl.device, &info);
+	if (!sgl.hizPyramid) {
+		SGL_Error("Failed to create depth pyramid: %s", SDL_GetError());
+		return false;
+	}
+
+	sgl.hizW = sgl.winW;
+	sgl.hizH = sgl.winH;
+	return true;
 }
 
-// Tiny Math Helper function
+static void sgl_BuildDepthPyramid(void) {
+	SGL_TRACE_BEGIN("sgl_Flush.depthPyramid");
+	SDL_GPUTextureSamplerBinding depth = { .texture = sgl.depthTexture, .sampler = sgl.depthSampler };
+	SDL_GPUStorageBufferReadWriteBinding rw = { .buffer = sgl.hizPyramid, .cycle = false };
+	SGL_HiZLevel src = { 0, (Uint32)sgl.winW, (Uint32)sgl.winH, 1 };
 
-static Vec3 sgl_Vec3Add(Vec3 v1, Vec3 v2) {
-	return (Vec3){
-		v1.x + v2.x,
-		v1.y + v2.y,
-		v1.z + v2.z,
-	};
+	// One pass per level so every level sees the previous one finished
+	for (int i = 0; i < sgl.hizLevelCount; i++) {
+		SGL_HiZBuildParams params = { src, sgl.hizLevels[i] };
+
+		SDL_GPUComputePass* cp = SDL_BeginGPUComputePass(sgl.curCmd, NULL, 0, &rw, 1);
+		SDL_BindGPUComputePipeline(cp, sgl.hizBuildPipeline);
+		SDL_BindGPUComputeSamplers(cp, 0, &depth, 1);
+		SDL_PushGPUComputeUniformData(sgl.curCmd, 0, &params, sizeof(params));
+		SDL_DispatchGPUCompute(cp, (params.dst.width + 7) / 8, (params.dst.height + 7) / 8, 1);
+		SDL_EndGPUComputePass(cp);
+
+		src = sgl.hizLevels[i];
+	}
+	SGL_TRACE_END("sgl_Flush.depthPyramid");
+}
+
+static void sgl_DispatchOcclusionCull(Uint32 count, Uint32 phase) {
+	SGL_HiZCullParams params = {
+		.viewProj = sgl.currentMatrix,
+		.count = count,
+		.firstSlot = sgl.occlusionSlot,
+		.phase = phase,
+		.levelCount = phase ? (Uint32)sgl.hizLevelCount : 0, // phase 0 only tests the frustum
+	};
+	SDL_memcpy(params.levels, sgl.hizLevels, sizeof(params.levels));
+
+	SDL_GPUStorageBufferReadWriteBinding rw[3] = {
+		{ .buffer = sgl.visibleBuffer, .cycle = false },
+		{ .buffer = sgl.drawArgsBuffer, .cycle = false },
+		{ .buffer = sgl.visibilityBuffer, .cycle = false },
+	};
+
+	SGL_TRACE_BEGIN("sgl_Flush.occlusionCull");
+	SDL_GPUComputePass* cp = SDL_BeginGPUComputePass(sgl.curCmd, NULL, 0, rw, 3);
+	SDL_BindGPUComputePipeline(cp, sgl.hizCullPipeline);
+	SDL_GPUBuffer* ro[] = { sgl.instanceBuffer, sgl.hizPyramid };
+	SDL_BindGPUComputeStorageBuffers(cp, 0, ro, 2);
+	SDL_PushGPUComputeUniformData(sgl.curCmd, 0, &params, sizeof(params));
+	SDL_DispatchGPUCompute(cp, (count + 63) / 64, 1, 1);
+	SDL_EndGPUComputePass(cp);
+	SGL_TRACE_END("sgl_Flush.occlusionCull");
+}
+
+static void sgl_DrawOcclusionPhase(SDL_GPUGraphicsPipeline* pipeline, Uint32 phase) {
+	SDL_GPURenderPass* pass = sgl_BeginScenePass(pipeline, &sgl.currentMatrix, sgl.visibleBuffer);
+	if (!pass)
+		return;
+	SDL_DrawGPUPrimitivesIndirect(pass, sgl.drawArgsBuffer, phase * sizeof(SDL_GPUIndirectDrawCommand), 1);
+	sgl_EndScenePass(pass);
+}
+
+// Occlusion culled draw of the first `count` instances of the transfer buffer.
+// Returns false when the batch has to be drawn the normal way.
+static bool sgl_DrawOccluded(Uint32 count, SDL_GPUGraphicsPipeline* pipeline) {
+	if (!sgl.swapchainTex || !sgl.depthSampled)
+		return false;
+	if (sgl.occlusionSlot + count > sgl.occlusionCapacity)
+		return false;
+	if (!sgl_PrepareDepthPyramid())
+		return false;
+
+	SGL_TRACE_BEGIN("sgl_Flush.copyPass");
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(sgl.curCmd);
+	SDL_GPUTransferBufferLocation src = { .transfer_buffer = sgl.transferBuffer, .offset = 0 };
+	SDL_GPUBufferRegion dst = {
+		.buffer = sgl.instanceBuffer,
+		.offset = 0,
+		.size = (Uint32)(count * sizeof(SGL_InstanceData)),
+	};
+	SDL_UploadToGPUBuffer(copy, &src, &dst, true);
+
+	SDL_GPUTransferBufferLocation argsSrc = { .transfer_buffer = sgl.drawArgsReset, .offset = 0 };
+	SDL_GPUBufferRegion argsDst = {
+		.buffer = sgl.drawArgsBuffer,
+		.offset = 0,
+		.size = 2 * sizeof(SDL_GPUIndirectDrawCommand),
+	};
+	SDL_UploadToGPUBuffer(copy, &argsSrc, &argsDst, true);
+	SDL_EndGPUCopyPass(copy);
+	SGL_TRACE_END("sgl_Flush.copyPass");
+
+	sgl_DispatchOcclusionCull(count, 0);
+	sgl_DrawOcclusionPhase(pipeline, 0);
+
+	sgl_BuildDepthPyramid();
+
+	sgl_DispatchOcclusionCull(count, 1);
+	sgl_DrawOcclusionPhase(pipeline, 1);
+
+	sgl.occlusionSlot += count;
+	return true;
+}
+
+bool sgl_SetOcclusionCulling(bool enable) {
+	sgl.occlusionEnabled = enable;
+	sgl.occlusionFailed = false;
+
+	// Before sgl_InitWindow the resources are created on first use
+	if (enable && sgl.device && !sgl_CreateOcclusionResources()) {
+		sgl.occlusionEnabled = false;
+		return false;
+	}
+	return true;
+}
+
+bool sgl_IsOcclusionCullingEnabled(void) { return sgl.occlusionEnabled && !sgl.occlusionFailed; }
+
+// The next batch starts with the current camera as its only one
+static void sgl_ResetCameraTable(void) {
+	sgl.cameraMatrices[0] = sgl.currentMatrix;
+	sgl.cameraCount = 1;
+	sgl.cameraIndex = 0;
+}
+
+// internal flush
+static void sgl_Flush(SGL_FlushReason reason) {
+	if (sgl.instanceCount == 0)
+		return;
+
+	// Nothing to draw into this frame, drop the batch without touching the GPU
+	if (sgl.frameSkipped && !sgl.renderTarget) {
+		sgl.instanceCount = 0;
+		sgl.opaqueCount = 0;
+		sgl.translucentCount = 0;
+		sgl.batchFeatures = 0;
+		sgl_ResetCameraTable();
+		return;
+	}
+
+	sgl.stats.flushCount++;
+	sgl.stats.flushReasons[reason]++;
+	sgl.stats.instanceBytesUploaded += (uint64_t)sgl.instanceCount * sizeof(SGL_InstanceData);
+
+	bool sorted3D = (sgl.currentMode == SGL_BATCH_3D);
+	bool occlude = sorted3D && sgl.opaqueCount > 0 && !sgl.renderTarget && sgl_OcclusionReady();
+
+	// The transfer buffer is only mapped for this copy
+	SGL_TRACE_BEGIN("sgl_Flush.map");
+	SGL_InstanceData* mapped =
+		(SGL_InstanceData*)SDL_MapGPUTransferBuffer(sgl.device, sgl.transferBuffer, true);
+	SGL_TRACE_END("sgl_Flush.map");
+	if (!mapped) {
+		SGL_Error("Failed to map transfer buffer in Flush! GPU might be lost. %s", SDL_GetError());
+		sgl.instanceCount = 0;
+		sgl.opaqueCount = 0;
+		sgl.translucentCount = 0;
+		sgl.batchFeatures = 0;
+		sgl_ResetCameraTable();
+		return;
+	}
+
+	SGL_TRACE_BEGIN("sgl_Flush.copy");
+	if (sorted3D)
+		sgl_GatherSorted3D(mapped, !occlude);
+	else
+		sgl_StreamCopy(mapped, sgl.staging, sgl.instanceCount * sizeof(SGL_InstanceData));
+	SGL_TRACE_END("sgl_Flush.copy");
+
+	SGL_TRACE_BEGIN("sgl_Flush.unmap");
+	SDL_UnmapGPUTransferBuffer(sgl.device, sgl.transferBuffer);
+	SGL_TRACE_END("sgl_Flush.unmap");
+
+	if (sorted3D) {
+		// Opaque: no blending, so early-Z rejects everything behind the front-most surfaces.
+		// Translucent: blended over it without writing depth.
+		SGL_PipelineState s = sgl_CurrentPipelineState();
+		SGL_DepthMode depth = SGL_PIPELINE_DEPTH(s);
+		SGL_BlendMode blend = SGL_PIPELINE_BLEND(s);
+		SGL_PipelineState target = s & SGL_PIPELINE_OFFSCREEN;
+		SGL_PipelineState opaque =
+			SGL_PIPELINE_STATE(SGL_BLEND_NONE, depth, SGL_PIPELINE_CULL(s)) | target;
+		SGL_PipelineState translucent = SGL_PIPELINE_STATE(
+											(blend == SGL_BLEND_NONE) ? SGL_BLEND_ALPHA : blend,
+											(depth == SGL_DEPTH_READ_WRITE) ? SGL_DEPTH_READ_ONLY : depth,
+											SGL_PIPELINE_CULL(s)
+										) |
+										target;
+
+		SDL_GPUGraphicsPipeline* opaquePipeline =
+			sgl_SpecializePipeline(sgl_PipelineForState(opaque), opaque);
+		SDL_GPUGraphicsPipeline* translucentPipeline =
+			sgl_SpecializePipeline(sgl_PipelineForState(translucent), translucent);
+		if (!occlude || !sgl_DrawOccluded(sgl.opaqueCount, opaquePipeline))
+			sgl_DrawBatch(0, sgl.opaqueCount, opaquePipeline);
+		sgl_DrawBatch(sgl.opaqueCount, sgl.translucentCount, translucentPipeline);
+	} else {
+		SGL_PipelineState s = sgl_CurrentPipelineState();
+		SDL_GPUGraphicsPipeline* pipeline = sgl_ResolvePipeline();
+		if (sgl.batchFeatures & SGL_BATCH_HAS_SOFT_EDGE) {
+			SGL_PipelineState soft = sgl_SoftEdgeState(s);
+			if (soft != s)
+				pipeline = sgl_PipelineForState(soft);
+			s = soft;
+		}
+		sgl_DrawBatch(0, sgl.instanceCount, sgl_SpecializePipeline(pipeline, s));
+	}
+
+	// RESET STATE FOR NEXT BATCH
+	sgl.instanceCount = 0;
+	sgl.opaqueCount = 0;
+	sgl.translucentCount = 0;
+	sgl.batchFeatures = 0;
+	sgl_ResetCameraTable();
+}
+
+// Make `m` the camera of the following instances. A camera change joins the batch as a
+// new entry of its camera table instead of flushing, unless the batch can't mix cameras:
+// custom shaders only know the first matrix, occlusion culling tests with one.
+static void sgl_SetBatchMatrix(SGL_Matrix m) {
+	sgl.currentMatrix = m;
+	if (sgl.instanceCount == 0) {
+		sgl_ResetCameraTable();
+		return;
+	}
+
+	for (int i = 0; i < sgl.cameraCount; i++) {
+		if (SDL_memcmp(&sgl.cameraMatrices[i], &m, sizeof(SGL_Matrix)) == 0) {
+			sgl.cameraIndex = i;
+			return;
+		}
+	}
+
+	bool mixable = sgl.activePipeline == sgl.defaultPipeline &&
+				   !(sgl.currentMode == SGL_BATCH_3D && sgl_IsOcclusionCullingEnabled());
+	if (!mixable || sgl.cameraCount >= SGL_MAX_BATCH_CAMERAS) {
+		sgl_Flush(SGL_FLUSH_CAMERA_CHANGE); // resets the table to `m`
+		return;
+	}
+
+	sgl.cameraIndex = sgl.cameraCount;
+	sgl.cameraMatrices[sgl.cameraCount++] = m;
+}
+
+// Shapes antialiased (or cut out) through alpha need blending even at full opacity
+static bool sgl_ShapeHasSoftEdge(f32 type) {
+	int t = (int)type;
+	return t == SGL_SHAPE_CIRCLE || t == SGL_SHAPE_TILEMAP || t == SGL_SHAPE_LINE ||
+		   (t >= SGL_SHAPE_ROUNDED_RECT && t <= SGL_SHAPE_ARC);
+}
+
+// True when a 2D instance lies entirely outside the view rectangle
+static bool sgl_CullInstance2D(const SGL_InstanceData* inst) {
+	int type = (int)inst->type;
+	f32 minX, minY, maxX, maxY;
+
+	if (type == SGL_SHAPE_LINE) {
+		// Endpoints in x, y / w, h, thickness in p3
+		f32 r = inst->p3 * 0.5f;
+		minX = SDL_min(inst->x, inst->w) - r;
+		maxX = SDL_max(inst->x, inst->w) + r;
+		minY = SDL_min(inst->y, inst->h) - r;
+		maxY = SDL_max(inst->y, inst->h) + r;
+	} else {
+		// Tilemaps keep their tile counts where the origin would be
+		f32 ox = (type == SGL_SHAPE_TILEMAP) ? 0.0f : inst->ox;
+		f32 oy = (type == SGL_SHAPE_TILEMAP) ? 0.0f : inst->oy;
+
+		if (inst->angle != 0.0f) {
+			// Any rotation around the origin stays inside the circle through the farthest corner
+			f32 dx = SDL_max(SDL_fabsf(ox), SDL_fabsf(inst->w - ox));
+			f32 dy = SDL_max(SDL_fabsf(oy), SDL_fabsf(inst->h - oy));
+			f32 r = SDL_sqrtf(dx * dx + dy * dy);
+			minX = inst->x - r;
+			maxX = inst->x + r;
+			minY = inst->y - r;
+			maxY = inst->y + r;
+		} else {
+			minX = inst->x - ox;
+			minY = inst->y - oy;
+			maxX = minX + inst->w;
+			maxY = minY + inst->h;
+		}
+	}
+
+	return maxX < sgl.view.min.x || minX > sgl.view.max.x || maxY < sgl.view.min.y ||
+		   minY > sgl.view.max.y;
+}
+
+// Set by sgl_CreateTexture when every texel has alpha 255
+static bool sgl_IsLayerOpaque(int layer) {
+	return sgl.opaqueLayers && layer >= 0 && layer < sgl.maxTextures && sgl.opaqueLayers[layer];
+}
+
+// Record one instance into the current batch.
+// 2D goes straight to the transfer buffer, 3D is staged and sorted at flush.
+static void sgl_EmitInstance(const SGL_InstanceData* inst) {
+	// Before anything else, culled instances take no buffer space and cause no flush
+	if (sgl.viewCulling && sgl.view.valid && sgl.currentMode == SGL_BATCH_2D &&
+		sgl_CullInstance2D(inst)) {
+		sgl.stats.culled++;
+		return;
+	}
+
+	if (sgl.instanceCount >= (Uint32)sgl.maxInstances) {
+		sgl_Flush(SGL_FLUSH_CAPACITY);
+	}
+
+	sgl.stats.instances++;
+
+	int type = (int)inst->type;
+	sgl.batchFeatures |= (type == SGL_SHAPE_RECT) ? SGL_BATCH_HAS_RECT
+						 : (type == 100)		  ? SGL_BATCH_HAS_CUBE
+												  : SGL_BATCH_HAS_OTHER;
+	if (inst->texIndex >= 0.0f)
+		sgl.batchFeatures |= SGL_BATCH_HAS_TEXTURE;
+	if (inst->angle != 0.0f)
+		sgl.batchFeatures |= SGL_BATCH_HAS_ROTATION;
+	if (sgl_ShapeHasSoftEdge(inst->type))
+		sgl.batchFeatures |= SGL_BATCH_HAS_SOFT_EDGE;
+
+	// Instances of a later camera of the batch carry its index above the shape type
+	SGL_InstanceData tagged;
+	const SGL_InstanceData* out = inst;
+	if (sgl.cameraIndex) {
+		tagged = *inst;
+		tagged.type += (f32)(sgl.cameraIndex * SGL_CAMERA_TYPE_STRIDE);
+		out = &tagged;
+	}
+
+	if (sgl.currentMode != SGL_BATCH_3D) {
+		// Now safe to write because Flush() reset instanceCount
+		sgl.staging[sgl.instanceCount++] = *out;
+		return;
+	}
+
+	// Cubes keep their center in x, y, w, quads (101) their min corner in x, y, w and
+	// their extent in ox, oy, z, everything else is at x, y, z
+	f32 cx = inst->x;
+	f32 cy = inst->y;
+	f32 cz = (inst->type == 100.0f) ? inst->w : inst->z;
+	if (inst->type == 101.0f) {
+		cx += inst->ox * 0.5f;
+		cy += inst->oy * 0.5f;
+		cz = inst->w + inst->z * 0.5f;
+	}
+	f32 depth = (cx - sgl.viewPos.x) * sgl.viewDir.x + (cy - sgl.viewPos.y) * sgl.viewDir.y +
+				(cz - sgl.viewPos.z) * sgl.viewDir.z;
+
+	// Textured instances are opaque only if the texture is: its alpha multiplies the tint
+	bool opaque = inst->a >= 1.0f && !sgl_ShapeHasSoftEdge(inst->type) &&
+				  (inst->texIndex < 0.0f || sgl_IsLayerOpaque((int)inst->texIndex));
+
+	Uint32 slot;
+	SGL_SortKey* key;
+	if (opaque) {
+		slot = sgl.opaqueCount++;
+		key = &sgl.sortKeys[slot];
+	} else {
+		slot = sgl.maxInstances - 1 - sgl.translucentCount++;
+		key = &sgl.sortKeys[sgl.maxInstances - sgl.translucentCount];
+	}
+
+	sgl.staging[slot] = *out;
+	key->depth = depth;
+	key->index = slot;
+	sgl.instanceCount++;
+}
+
+static SGL_InstanceData sgl_MakeInstance(
+	f32 x,
+	f32 y,
+	f32 w,
+	f32 h,
+	f32 angle,
+	f32 ox,
+	f32 oy,
+	f32 z,
+	int type,
+	SGL_COLOR color
+) {
+	return (SGL_InstanceData){
+		.x = x,
+		.y = y,
+		.w = w,
+		.h = h,
+		.angle = angle,
+		.ox = ox,
+		.oy = oy,
+		.z = z,
+		.type = (f32)type,
+		// .texIndex = 0,
+		.texIndex = -1.0f,
+		.p2 = 0,
+		.p3 = 0,
+		.r = color.r / 255.0f,
+		.g = color.g / 255.0f,
+		.b = color.b / 255.0f,
+		.a = color.a / 255.0f,
+	};
+}
+
+static void sgl_PushInstance(
+	f32 x,
+	f32 y,
+	f32 w,
+	f32 h,
+	f32 angle,
+	f32 ox,
+	f32 oy,
+	f32 z,
+	int type,
+	SGL_COLOR color
+) {
+	SGL_InstanceData inst = sgl_MakeInstance(x, y, w, h, angle, ox, oy, z, type, color);
+	sgl_EmitInstance(&inst);
+}
+
+// Tiny Math Helper function
+
+static Vec3 sgl_Vec3Add(Vec3 v1, Vec3 v2) {
+	return (Vec3){
+		v1.x + v2.x,
+		v1.y + v2.y,
+		v1.z + v2.z,
+	};
 }
 
 static Vec3 sgl_Vec3Sub(Vec3 v1, Vec3 v2) {
@@ -1178,670 +3593,4239 @@ uint64_t sgl_GetPerfCount(void) { return SDL_GetPerformanceCounter(); }
 
 uint64_t sgl_GetPerfFreq(void) { return SDL_GetPerformanceFrequency(); }
 
-// Texture API
-SGL_Texture* sgl_CreateTexture(void* pixels, int width, int height) {
+// --- Frame Stats ---
 
-	Uint32 dataSize = width * height * 4;
+// Close the current frame: snapshot the counters into the history ring and start over
+static void sgl_EndFrameStats(void) {
+	uint64_t now = SDL_GetPerformanceCounter();
+	if (sgl.frameMark) {
+		sgl.stats.frameMs = sgl_PerfToMs(now - sgl.frameMark);
+		int bin = (int)(sgl.stats.frameMs / SGL_FRAME_HISTOGRAM_BIN_MS);
+		sgl.frameHistogram[bin < SGL_FRAME_HISTOGRAM_BINS ? bin : SGL_FRAME_HISTOGRAM_BINS - 1]++;
+	}
+	sgl.frameMark = now;
+	sgl.stats.textureLayersUsed = sgl.nextTextureLayer - sgl.freeTextureCount;
+	sgl.stats.textureLayersFree = sgl.maxTextures - sgl.stats.textureLayersUsed;
+	sgl.stats.textureLayersCapacity = sgl.textureLayerCapacity;
+
+	sgl.lastStats = sgl.stats;
+	sgl.statsHistory[sgl.statsHistoryHead] = sgl.stats;
+	sgl.statsHistoryHead = (sgl.statsHistoryHead + 1) % SGL_STATS_HISTORY;
+	if (sgl.statsHistoryCount < SGL_STATS_HISTORY)
+		sgl.statsHistoryCount++;
+
+	sgl.stats = (SGL_FrameStats){ 0 };
+}
 
-	int targetLayer = -1;
+SGL_FrameStats sgl_GetFrameStats(void) { return sgl.lastStats; }
 
-	if (sgl.freeTextureCount > 0) {
-		sgl.freeTextureCount--;
-		targetLayer = sgl.freeTextureLayers[sgl.freeTextureCount];
-	} else if (sgl.nextTextureLayer < SGL_MAX_TEXTURES) {
-		targetLayer = sgl.nextTextureLayer;
-		sgl.nextTextureLayer++;
-	} else {
-		SGL_Error("Texture array is entirely full! (Max %d)", SGL_MAX_TEXTURES);
-		return NULL;
-	}
+int sgl_GetFrameStatsHistory(SGL_FrameStats* out, int maxCount) {
+	if (!out || maxCount <= 0)
+		return 0;
 
-	if (width != SGL_TEXTURE_SIZE || height != SGL_TEXTURE_SIZE) {
-		SGL_Error("Raw texture data must exactly match %dx%d!", SGL_TEXTURE_SIZE, SGL_TEXTURE_SIZE);
-		return NULL;
+	int count = (maxCount < sgl.statsHistoryCount) ? maxCount : sgl.statsHistoryCount;
+	// Oldest of the last `count` frames
+	int start = sgl.statsHistoryHead - count;
+	if (start < 0)
+		start += SGL_STATS_HISTORY;
+
+	for (int i = 0; i < count; i++) {
+		out[i] = sgl.statsHistory[(start + i) % SGL_STATS_HISTORY];
 	}
+	return count;
+}
 
-	SDL_GPUTransferBufferCreateInfo tbufInfo = {
-		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
-		.size = dataSize,
-	};
-	SDL_GPUTransferBuffer* tbuf = SDL_CreateGPUTransferBuffer(sgl.device, &tbufInfo);
+static int sgl_CompareF64(const void* a, const void* b) {
+	f64 x = *(const f64*)a;
+	f64 y = *(const f64*)b;
+	return (x > y) - (x < y);
+}
 
-	// Copy to Transfer Buffer
-	Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, tbuf, false);
-	SDL_memcpy(map, pixels, dataSize);
-	SDL_UnmapGPUTransferBuffer(sgl.device, tbuf);
+f64 sgl_GetFrameTimePercentile(f32 percentile) {
+	if (sgl.statsHistoryCount == 0)
+		return 0.0;
 
-	// Transfer Buffer -> GPU Texture
-	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
-	SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
+	f64 samples[SGL_STATS_HISTORY];
+	for (int i = 0; i < sgl.statsHistoryCount; i++) {
+		samples[i] = sgl.statsHistory[i].cpuFrameMs;
+	}
+	SDL_qsort(samples, (size_t)sgl.statsHistoryCount, sizeof(f64), sgl_CompareF64);
+
+	if (percentile < 0.0f)
+		percentile = 0.0f;
+	if (percentile > 100.0f)
+		percentile = 100.0f;
+
+	// nearest-rank
+	int idx = (int)ceil((percentile / 100.0) * sgl.statsHistoryCount) - 1;
+	if (idx < 0)
+		idx = 0;
+	return samples[idx];
+}
 
-	SDL_GPUTextureTransferInfo source = {
-		.transfer_buffer = tbuf,
-		.offset = 0,
-		.pixels_per_row = (Uint32)width,
-		.rows_per_layer = (Uint32)height,
-	};
+int sgl_GetFrameTimeHistogram(uint32_t* out, int maxBins) {
+	if (!out || maxBins <= 0)
+		return 0;
 
-	SDL_GPUTextureRegion dest = {
-		.texture = sgl.globalTextureArray,
-		.layer = (Uint32)targetLayer,
-		.w = (Uint32)width,
-		.h = (Uint32)height,
-		.d = 1,
-	};
+	int count = (maxBins < SGL_FRAME_HISTOGRAM_BINS) ? maxBins : SGL_FRAME_HISTOGRAM_BINS;
+	SDL_memcpy(out, sgl.frameHistogram, (size_t)count * sizeof(uint32_t));
+	return count;
+}
 
-	SDL_UploadToGPUTexture(copyPass, &source, &dest, false);
+void sgl_ResetFrameTimeHistogram(void) { SDL_memset(sgl.frameHistogram, 0, sizeof(sgl.frameHistogram)); }
 
-	SDL_EndGPUCopyPass(copyPass);
-	SDL_SubmitGPUCommandBuffer(cmd);
+// --- Tracing ---
+#ifdef SGL_ENABLE_TRACE
 
-	SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+typedef struct {
+	const char* name; // must be a string literal / outlive the dump
+	uint64_t ticks;
+	char phase;
+} SGL_TraceEventData;
 
-	SGL_Texture* wrapper = (SGL_Texture*)SDL_malloc(sizeof(SGL_Texture));
-	wrapper->id = targetLayer;
-	wrapper->width = (f32)width;
-	wrapper->height = (f32)height;
-	return wrapper;
-}
+// One ring per thread. Only the owning thread writes `events` and bumps `head`,
+// so recording needs no lock.
+typedef struct {
+	SDL_ThreadID tid;
+	SDL_AtomicInt head;
+	SGL_TraceEventData events[SGL_TRACE_CAPACITY];
+} SGL_TraceRing;
 
-SGL_Texture* sgl_LoadTexture(const char* filename) {
-	SDL_Surface* originalSurf = SDL_LoadBMP(filename);
-	if (!originalSurf) {
-		SGL_Error("Failed to load image: %s, error: %s", filename, SDL_GetError());
+static struct {
+	SDL_TLSID tls;
+	SDL_AtomicInt ringCount;
+	SGL_TraceRing* rings[SGL_TRACE_MAX_THREADS];
+	uint64_t baseTicks;
+} sgl_trace;
+
+static SGL_TraceRing* sgl_TraceGetRing(void) {
+	SGL_TraceRing* ring = (SGL_TraceRing*)SDL_GetTLS(&sgl_trace.tls);
+	if (ring)
+		return ring;
+
+	int slot = SDL_AddAtomicInt(&sgl_trace.ringCount, 1);
+	if (slot >= SGL_TRACE_MAX_THREADS) {
+		SDL_AddAtomicInt(&sgl_trace.ringCount, -1);
 		return NULL;
 	}
 
-	SDL_Surface* rgbaSurf = SDL_ConvertSurface(originalSurf, SDL_PIXELFORMAT_RGBA32);
-	SDL_DestroySurface(originalSurf);
-	if (!rgbaSurf) {
-		SGL_Error("Failed to convert image to RGBA32: %s", SDL_GetError());
+	ring = (SGL_TraceRing*)SDL_calloc(1, sizeof(SGL_TraceRing));
+	if (!ring)
 		return NULL;
-	}
-
-	SDL_Surface* finalSurf = rgbaSurf;
+	ring->tid = SDL_GetCurrentThreadID();
+	sgl_trace.rings[slot] = ring;
+	// Rings stay alive until the process exits so they can be dumped after the thread ends
+	SDL_SetTLS(&sgl_trace.tls, ring, NULL);
+	return ring;
+}
 
-	if (rgbaSurf->w != SGL_TEXTURE_SIZE || rgbaSurf->h != SGL_TEXTURE_SIZE) {
-		finalSurf =
-			SDL_ScaleSurface(rgbaSurf, SGL_TEXTURE_SIZE, SGL_TEXTURE_SIZE, SDL_SCALEMODE_NEAREST);
+void sgl_TraceEvent(const char* name, char phase) {
+	SGL_TraceRing* ring = sgl_TraceGetRing();
+	if (!ring)
+		return;
 
-		if (!finalSurf) {
-			SGL_Error("Failed to scale image %s: %s", filename, SDL_GetError());
-			SDL_DestroySurface(rgbaSurf);
-			return NULL;
-		}
+	int head = SDL_GetAtomicInt(&ring->head);
+	ring->events[head % SGL_TRACE_CAPACITY] = (SGL_TraceEventData){
+		.name = name,
+		.ticks = SDL_GetPerformanceCounter(),
+		.phase = phase,
+	};
+	SDL_SetAtomicInt(&ring->head, head + 1); // publish
+}
 
-		// Destroy the intermediate unscaled RGBA surface
-		SDL_DestroySurface(rgbaSurf);
+bool sgl_TraceDump(const char* filename) {
+	FILE* file = fopen(filename, "w");
+	if (!file) {
+		SGL_Error("Failed to open trace file: %s", filename);
+		return false;
 	}
 
-	SGL_Texture* tex = sgl_CreateTexture(finalSurf->pixels, finalSurf->w, finalSurf->h);
-	if (tex) {
-		tex->width = (f32)rgbaSurf->w;
-		tex->height = (f32)rgbaSurf->h;
+	const f64 toUs = 1000000.0 / (f64)SDL_GetPerformanceFrequency();
+	int ringCount = SDL_GetAtomicInt(&sgl_trace.ringCount);
+	if (ringCount > SGL_TRACE_MAX_THREADS)
+		ringCount = SGL_TRACE_MAX_THREADS;
+
+	bool first = true;
+	fprintf(file, "{\"traceEvents\":[\n");
+	for (int r = 0; r < ringCount; r++) {
+		SGL_TraceRing* ring = sgl_trace.rings[r];
+		if (!ring)
+			continue;
+
+		int head = SDL_GetAtomicInt(&ring->head);
+		int start = (head > SGL_TRACE_CAPACITY) ? head - SGL_TRACE_CAPACITY : 0;
+		for (int i = start; i < head; i++) {
+			const SGL_TraceEventData* ev = &ring->events[i % SGL_TRACE_CAPACITY];
+			fprintf(
+				file,
+				"%s{\"name\":\"%s\",\"cat\":\"sgl\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%llu}",
+				first ? "" : ",\n",
+				ev->name,
+				ev->phase,
+				(f64)(ev->ticks - sgl_trace.baseTicks) * toUs,
+				(unsigned long long)ring->tid
+			);
+			first = false;
+		}
 	}
+	fprintf(file, "\n]}\n");
+	fclose(file);
 
-	SDL_DestroySurface(finalSurf);
+	SGL_Log("Trace written to %s", filename);
+	return true;
+}
 
-	return tex;
+#endif // SGL_ENABLE_TRACE
+
+// Texture API
+
+static SDL_GPUTexture* sgl_CreateTextureArray(int layers) {
+	SDL_GPUTextureCreateInfo texInfo = {
+		.type = SDL_GPU_TEXTURETYPE_2D_ARRAY,
+		.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+		.width = sgl.textureSize,
+		.height = sgl.textureSize,
+		.layer_count_or_depth = (Uint32)layers,
+		.num_levels = 1,
+		.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER,
+	};
+	return SDL_CreateGPUTexture(sgl.device, &texInfo);
 }
 
-void sgl_DestroyTexture(SGL_Texture* texture) {
-	if (texture) {
-		if (sgl.freeTextureCount < SGL_MAX_TEXTURES) {
-			sgl.freeTextureLayers[sgl.freeTextureCount] = texture->id;
-			sgl.freeTextureCount++;
-		}
-		SDL_free(texture);
+// Reallocate the texture array with at least `minLayers` layers (doubling) and copy the
+// layers handed out so far GPU-side. Draws already recorded keep the old array alive.
+static bool sgl_GrowTextureArray(int minLayers) {
+	int newCapacity = sgl.textureLayerCapacity > 0 ? sgl.textureLayerCapacity : 1;
+	while (newCapacity < minLayers)
+		newCapacity *= 2;
+	if (newCapacity > sgl.maxTextures)
+		newCapacity = sgl.maxTextures;
+
+	SDL_GPUTexture* newArray = sgl_CreateTextureArray(newCapacity);
+	if (!newArray) {
+		SGL_Error("Failed to grow texture array to %d layers: %s", newCapacity, SDL_GetError());
+		return false;
 	}
-}
 
-void sgl_DrawTexture(SGL_Texture* texture, f32 x, f32 y, f32 w, f32 h, SGL_COLOR tint) {
-	if (!texture)
-		return;
+	if (sgl.globalTextureArray && sgl.nextTextureLayer > 0) {
+		SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+		SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
+		for (int layer = 0; layer < sgl.nextTextureLayer; layer++) {
+			SDL_GPUTextureLocation src = {
+				.texture = sgl.globalTextureArray,
+				.layer = (Uint32)layer,
+			};
+			SDL_GPUTextureLocation dst = {
+				.texture = newArray,
+				.layer = (Uint32)layer,
+			};
+			SDL_CopyGPUTextureToTexture(copyPass, &src, &dst, sgl.textureSize, sgl.textureSize, 1, false);
+		}
+		SDL_EndGPUCopyPass(copyPass);
+		SDL_SubmitGPUCommandBuffer(cmd);
+	}
 
-	sgl_PushInstance(x, y, w, h, 0, 0, 0, 0.0f, SGL_SHAPE_RECT, tint);
+	if (sgl.globalTextureArray)
+		SDL_ReleaseGPUTexture(sgl.device, sgl.globalTextureArray);
 
-	sgl.mappedPtr[sgl.instanceCount - 1].texIndex = (f32)texture->id;
+	SGL_Log("Texture array grown: %d -> %d layers", sgl.textureLayerCapacity, newCapacity);
+	sgl.globalTextureArray = newArray;
+	sgl.globalTextureBinding.texture = newArray;
+	sgl.textureArrayGeneration++; // render textures drawn this frame went to the old array
+	sgl.textureLayerCapacity = newCapacity;
+	return true;
+}
+
+// Take a layer from the free list, or a new one (growing the array). -1 when full.
+static int sgl_AllocTextureLayer(void) {
+	if (sgl.freeTextureCount > 0) {
+		sgl.freeTextureCount--;
+		return sgl.freeTextureLayers[sgl.freeTextureCount];
+	}
+
+	if (sgl.nextTextureLayer >= sgl.maxTextures) {
+		SGL_Error("Texture array is entirely full! (Max %d)", sgl.maxTextures);
+		return -1;
+	}
+
+	if (sgl.nextTextureLayer >= sgl.textureLayerCapacity &&
+		!sgl_GrowTextureArray(sgl.nextTextureLayer + 1)) {
+		return -1;
+	}
+	return sgl.nextTextureLayer++;
+}
+
+// True when every RGBA32 pixel has alpha 255
+static bool sgl_PixelsOpaque(const void* pixels, size_t count) {
+	const Uint8* p = (const Uint8*)pixels;
+	for (size_t i = 0; i < count; i++) {
+		if (p[i * 4 + 3] != 255)
+			return false;
+	}
+	return true;
+}
+
+static void sgl_FreeTextureLayer(int layer) {
+	// Render textures, tilemaps and packs reuse it without a pixel check
+	if (sgl_IsLayerOpaque(layer))
+		sgl.opaqueLayers[layer] = false;
+	if (sgl.freeTextureLayers && sgl.freeTextureCount < sgl.maxTextures) {
+		sgl.freeTextureLayers[sgl.freeTextureCount] = layer;
+		sgl.freeTextureCount++;
+	}
+}
+
+// FNV-1a over 64-bit words, the tail byte by byte
+static Uint64 sgl_HashPixels(const void* pixels, size_t size) {
+	const Uint8* bytes = (const Uint8*)pixels;
+	Uint64 hash = 0xcbf29ce484222325ull;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		Uint64 word;
+		SDL_memcpy(&word, bytes + i, 8);
+		hash = (hash ^ word) * 0x100000001b3ull;
+	}
+	for (; i < size; i++)
+		hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+	return hash ? hash : 1; // 0 means not hashed
+}
+
+static SGL_TextureEntry* sgl_FindTextureEntry(const char* path) {
+	for (SGL_TextureEntry* e = sgl.textureEntries; e; e = e->next) {
+		if (e->path && SDL_strcmp(e->path, path) == 0)
+			return e;
+	}
+	return NULL;
+}
+
+// A hash match alone could be a collision, only identical pixels are shared
+static SGL_TextureEntry* sgl_FindTexturePixels(const void* pixels, size_t size, Uint64 hash) {
+	for (SGL_TextureEntry* e = sgl.textureEntries; e; e = e->next) {
+		if (e->hash == hash && e->pixels && SDL_memcmp(e->pixels, pixels, size) == 0)
+			return e;
+	}
+	return NULL;
+}
+
+static SGL_Texture* sgl_ShareTexture(SGL_TextureEntry* entry) {
+	entry->refs++;
+	sgl.stats.textureCacheHits++;
+	return &entry->texture;
+}
+
+SGL_Texture* sgl_CreateTexture(void* pixels, int width, int height) {
+
+	Uint32 dataSize = width * height * 4;
+
+	// Check before taking a layer so a bad call doesn't leak one
+	if (width != sgl.textureSize || height != sgl.textureSize) {
+		SGL_Error("Raw texture data must exactly match %dx%d!", sgl.textureSize, sgl.textureSize);
+		return NULL;
+	}
+
+	Uint64 hash = 0;
+	if (sgl.textureDedup) {
+		hash = sgl_HashPixels(pixels, dataSize);
+		SGL_TextureEntry* shared = sgl_FindTexturePixels(pixels, dataSize, hash);
+		if (shared)
+			return sgl_ShareTexture(shared);
+	}
+
+	SGL_TextureEntry* entry = (SGL_TextureEntry*)SDL_calloc(1, sizeof(SGL_TextureEntry));
+	int targetLayer = entry ? sgl_AllocTextureLayer() : -1;
+	if (targetLayer < 0) {
+		SDL_free(entry);
+		return NULL;
+	}
+
+	// Without the copy the entry can't be compared, so it is never shared
+	if (hash) {
+		entry->pixels = (Uint8*)SDL_malloc(dataSize);
+		if (entry->pixels)
+			SDL_memcpy(entry->pixels, pixels, dataSize);
+		else
+			hash = 0;
+	}
+
+	SGL_TRACE_BEGIN("sgl_CreateTexture");
+
+	SDL_GPUTransferBufferCreateInfo tbufInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = dataSize,
+	};
+	SDL_GPUTransferBuffer* tbuf = SDL_CreateGPUTransferBuffer(sgl.device, &tbufInfo);
+
+	// Copy to Transfer Buffer
+	Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, tbuf, false);
+	SDL_memcpy(map, pixels, dataSize);
+	SDL_UnmapGPUTransferBuffer(sgl.device, tbuf);
+
+	// Transfer Buffer -> GPU Texture
+	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+	SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
+
+	SDL_GPUTextureTransferInfo source = {
+		.transfer_buffer = tbuf,
+		.offset = 0,
+		.pixels_per_row = (Uint32)width,
+		.rows_per_layer = (Uint32)height,
+	};
+
+	SDL_GPUTextureRegion dest = {
+		.texture = sgl.globalTextureArray,
+		.layer = (Uint32)targetLayer,
+		.w = (Uint32)width,
+		.h = (Uint32)height,
+		.d = 1,
+	};
+
+	SDL_UploadToGPUTexture(copyPass, &source, &dest, false);
+	sgl.stats.textureBytesUploaded += dataSize;
+
+	SDL_EndGPUCopyPass(copyPass);
+	SDL_SubmitGPUCommandBuffer(cmd);
+
+	SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+
+	if (sgl.opaqueLayers)
+		sgl.opaqueLayers[targetLayer] = sgl_PixelsOpaque(pixels, (size_t)width * height);
+
+	entry->texture.id = targetLayer;
+	entry->texture.width = (f32)width;
+	entry->texture.height = (f32)height;
+	entry->refs = 1;
+	entry->hash = hash;
+	entry->next = sgl.textureEntries;
+	sgl.textureEntries = entry;
+
+	SGL_TRACE_END("sgl_CreateTexture");
+	return &entry->texture;
+}
+
+SGL_Texture* sgl_LoadTexture(const char* filename) {
+	SGL_TextureEntry* cached = filename ? sgl_FindTextureEntry(filename) : NULL;
+	if (cached)
+		return sgl_ShareTexture(cached);
+
+	SGL_TRACE_BEGIN("sgl_LoadTexture.decode");
+	SDL_Surface* originalSurf = SDL_LoadBMP(filename);
+	SDL_Surface* rgbaSurf = NULL;
+	if (originalSurf) {
+		rgbaSurf = SDL_ConvertSurface(originalSurf, SDL_PIXELFORMAT_RGBA32);
+		SDL_DestroySurface(originalSurf);
+	}
+	SGL_TRACE_END("sgl_LoadTexture.decode");
+
+	if (!originalSurf) {
+		SGL_Error("Failed to load image: %s, error: %s", filename, SDL_GetError());
+		return NULL;
+	}
+	if (!rgbaSurf) {
+		SGL_Error("Failed to convert image to RGBA32: %s", SDL_GetError());
+		return NULL;
+	}
+
+	SDL_Surface* finalSurf = rgbaSurf;
+	int sourceW = rgbaSurf->w;
+	int sourceH = rgbaSurf->h;
+
+	if (rgbaSurf->w != sgl.textureSize || rgbaSurf->h != sgl.textureSize) {
+		SGL_TRACE_BEGIN("sgl_LoadTexture.scale");
+		finalSurf =
+			SDL_ScaleSurface(rgbaSurf, sgl.textureSize, sgl.textureSize, SDL_SCALEMODE_NEAREST);
+		SGL_TRACE_END("sgl_LoadTexture.scale");
+
+		if (!finalSurf) {
+			SGL_Error("Failed to scale image %s: %s", filename, SDL_GetError());
+			SDL_DestroySurface(rgbaSurf);
+			return NULL;
+		}
+
+		// Destroy the intermediate unscaled RGBA surface
+		SDL_DestroySurface(rgbaSurf);
+	}
+
+	SGL_Texture* tex = sgl_CreateTexture(finalSurf->pixels, finalSurf->w, finalSurf->h);
+	SGL_TextureEntry* entry = (SGL_TextureEntry*)tex;
+	if (entry && entry->refs == 1) { // new, not shared through the pixel hash
+		tex->width = (f32)sourceW;
+		tex->height = (f32)sourceH;
+		entry->path = SDL_strdup(filename);
+	}
+
+	SDL_DestroySurface(finalSurf);
+
+	return tex;
+}
+
+// Pack and render textures are handles too, but owned by their pack or render texture
+static SGL_TextureEntry* sgl_GetTextureEntry(const SGL_Texture* texture) {
+	for (SGL_TextureEntry* e = sgl.textureEntries; e; e = e->next) {
+		if (&e->texture == texture)
+			return e;
+	}
+	return NULL;
+}
+
+SGL_Texture* sgl_RetainTexture(SGL_Texture* texture) {
+	if (!texture)
+		return NULL;
+
+	SGL_TextureEntry* entry = sgl_GetTextureEntry(texture);
+	if (!entry) {
+		SGL_Warn("sgl_RetainTexture: texture %d is owned by a pack or render texture", texture->id);
+		return texture;
+	}
+	entry->refs++;
+	return texture;
+}
+
+void sgl_DestroyTexture(SGL_Texture* texture) {
+	if (!texture)
+		return;
+
+	SGL_TextureEntry* entry = sgl_GetTextureEntry(texture);
+	if (!entry) {
+		SGL_Warn("sgl_DestroyTexture: texture %d is owned by a pack or render texture", texture->id);
+		return;
+	}
+	if (--entry->refs > 0)
+		return;
+
+	for (SGL_TextureEntry** link = &sgl.textureEntries; *link; link = &(*link)->next) {
+		if (*link == entry) {
+			*link = entry->next;
+			break;
+		}
+	}
+	sgl_FreeTextureLayer(texture->id);
+	SDL_free(entry->pixels);
+	SDL_free(entry->path);
+	SDL_free(entry);
+}
+
+int sgl_GetTextureRefCount(const SGL_Texture* texture) {
+	const SGL_TextureEntry* entry = texture ? sgl_GetTextureEntry(texture) : NULL;
+	return entry ? entry->refs : 0;
+}
+
+void sgl_SetTextureDedup(bool enable) { sgl.textureDedup = enable; }
+
+void sgl_DrawTexture(SGL_Texture* texture, f32 x, f32 y, f32 w, f32 h, SGL_COLOR tint) {
+	if (!texture)
+		return;
+
+	SGL_InstanceData inst = sgl_MakeInstance(x, y, w, h, 0, 0, 0, 0.0f, SGL_SHAPE_RECT, tint);
+	inst.texIndex = (f32)texture->id;
+	sgl_EmitInstance(&inst);
+}
+
+// --- Texture Packs ---
+// File layout, little endian: SGL_PackHeader, `count` SGL_PackEntry, then at `dataOffset`
+// (page aligned) every layer as layerSize * layerSize RGBA32 pixels, in entry order.
+
+#define SGL_PACK_MAGIC 0x4B504753u // "SGPK"
+#define SGL_PACK_VERSION 1
+#define SGL_PACK_NAME_MAX 48
+#define SGL_PACK_ALIGN 4096
+
+typedef struct {
+	Uint32 magic;
+	Uint32 version;
+	Uint32 layerSize;
+	Uint32 count;
+	Uint64 dataOffset;
+} SGL_PackHeader;
+
+typedef struct {
+	char name[SGL_PACK_NAME_MAX];
+	Uint32 width, height; // of the source image, reported as SGL_Texture width/height
+	Uint64 offset;		  // of the layer pixels from the start of the file
+} SGL_PackEntry;
+
+struct SGL_TexturePack {
+	SGL_Texture* textures;
+	SGL_PackEntry* entries;
+	int count;
+};
+
+typedef struct {
+	const Uint8* data;
+	size_t size;
+	bool mapped; // else SDL_LoadFile memory
+} SGL_MappedFile;
+
+static bool sgl_MapFile(const char* path, SGL_MappedFile* file) {
+	*file = (SGL_MappedFile){ 0 };
+#ifdef SGL_HAS_MMAP
+	int fd = open(path, O_RDONLY);
+	if (fd >= 0) {
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0) {
+			void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED) {
+				file->data = (const Uint8*)data;
+				file->size = (size_t)st.st_size;
+				file->mapped = true;
+			}
+		}
+		close(fd);
+		if (file->mapped)
+			return true;
+	}
+#endif
+	file->data = (const Uint8*)SDL_LoadFile(path, &file->size);
+	return file->data != NULL;
+}
+
+static void sgl_UnmapFile(SGL_MappedFile* file) {
+#ifdef SGL_HAS_MMAP
+	if (file->mapped) {
+		munmap((void*)file->data, file->size);
+		return;
+	}
+#endif
+	SDL_free((void*)file->data);
+}
+
+static const char* sgl_BaseName(const char* path) {
+	const char* name = path;
+	for (const char* c = path; *c; c++) {
+		if (*c == '/' || *c == '\\')
+			name = c + 1;
+	}
+	return name;
+}
+
+// Decode, convert and scale like sgl_LoadTexture, once, and write the result as a pack
+bool sgl_WriteTexturePack(const char* path, const char* const* files, int count, int layerSize) {
+	if (!path || !files || count <= 0 || layerSize <= 0) {
+		SGL_Error("sgl_WriteTexturePack needs a path, files and a layer size");
+		return false;
+	}
+
+	Uint64 layerBytes = (Uint64)layerSize * layerSize * 4;
+	Uint64 indexEnd = sizeof(SGL_PackHeader) + (Uint64)count * sizeof(SGL_PackEntry);
+	SGL_PackHeader header = {
+		.magic = SDL_Swap32LE(SGL_PACK_MAGIC),
+		.version = SDL_Swap32LE(SGL_PACK_VERSION),
+		.layerSize = SDL_Swap32LE((Uint32)layerSize),
+		.count = SDL_Swap32LE((Uint32)count),
+		.dataOffset = SDL_Swap64LE((indexEnd + SGL_PACK_ALIGN - 1) / SGL_PACK_ALIGN * SGL_PACK_ALIGN),
+	};
+	SGL_PackEntry* entries = (SGL_PackEntry*)SDL_calloc((size_t)count, sizeof(SGL_PackEntry));
+	SDL_IOStream* io = SDL_IOFromFile(path, "wb");
+	if (!entries || !io) {
+		SGL_Error("Failed to open texture pack %s: %s", path, SDL_GetError());
+		SDL_free(entries);
+		if (io)
+			SDL_CloseIO(io);
+		return false;
+	}
+
+	bool ok = SDL_SeekIO(io, (Sint64)SDL_Swap64LE(header.dataOffset), SDL_IO_SEEK_SET) >= 0;
+	for (int i = 0; ok && i < count; i++) {
+		SDL_Surface* original = SDL_LoadBMP(files[i]);
+		SDL_Surface* rgba = original ? SDL_ConvertSurface(original, SDL_PIXELFORMAT_RGBA32) : NULL;
+		if (original)
+			SDL_DestroySurface(original);
+		SDL_Surface* sized = rgba;
+		if (rgba && (rgba->w != layerSize || rgba->h != layerSize))
+			sized = SDL_ScaleSurface(rgba, layerSize, layerSize, SDL_SCALEMODE_NEAREST);
+		if (!sized) {
+			SGL_Error("Failed to pack %s: %s", files[i], SDL_GetError());
+			ok = false;
+		} else {
+			SDL_strlcpy(entries[i].name, sgl_BaseName(files[i]), SGL_PACK_NAME_MAX);
+			entries[i].width = SDL_Swap32LE((Uint32)rgba->w);
+			entries[i].height = SDL_Swap32LE((Uint32)rgba->h);
+			entries[i].offset = SDL_Swap64LE(SDL_Swap64LE(header.dataOffset) + (Uint64)i * layerBytes);
+			for (int y = 0; ok && y < layerSize; y++) {
+				const Uint8* row = (const Uint8*)sized->pixels + (size_t)y * sized->pitch;
+				ok = SDL_WriteIO(io, row, (size_t)layerSize * 4) == (size_t)layerSize * 4;
+			}
+		}
+		if (sized && sized != rgba)
+			SDL_DestroySurface(sized);
+		if (rgba)
+			SDL_DestroySurface(rgba);
+	}
+
+	// The header goes in last, so a pack that failed half way never looks valid
+	size_t indexSize = (size_t)count * sizeof(SGL_PackEntry);
+	ok = ok && SDL_SeekIO(io, 0, SDL_IO_SEEK_SET) == 0 &&
+		 SDL_WriteIO(io, &header, sizeof(header)) == sizeof(header) &&
+		 SDL_WriteIO(io, entries, indexSize) == indexSize;
+	ok = SDL_CloseIO(io) && ok;
+	SDL_free(entries);
+	if (!ok)
+		SGL_Error("Failed to write texture pack %s", path);
+	else
+		SGL_Log("Texture pack %s: %d layers of %dx%d", path, count, layerSize, layerSize);
+	return ok;
+}
+
+SGL_TexturePack* sgl_LoadTexturePack(const char* path) {
+	SGL_TRACE_BEGIN("sgl_LoadTexturePack");
+	SGL_MappedFile file;
+	if (!sgl_MapFile(path, &file)) {
+		SGL_Error("Failed to open texture pack %s: %s", path, SDL_GetError());
+		SGL_TRACE_END("sgl_LoadTexturePack");
+		return NULL;
+	}
+
+	SGL_PackHeader header = { 0 };
+	if (file.size >= sizeof(header))
+		SDL_memcpy(&header, file.data, sizeof(header));
+	Uint32 count = SDL_Swap32LE(header.count);
+	Uint32 layerSize = SDL_Swap32LE(header.layerSize);
+	Uint64 layerBytes = (Uint64)layerSize * layerSize * 4;
+	Uint64 dataOffset = SDL_Swap64LE(header.dataOffset);
+
+	const char* problem = NULL;
+	if (file.size < sizeof(header) || SDL_Swap32LE(header.magic) != SGL_PACK_MAGIC)
+		problem = "not a texture pack";
+	else if (SDL_Swap32LE(header.version) != SGL_PACK_VERSION)
+		problem = "unsupported version";
+	else if (layerSize != (Uint32)sgl.textureSize)
+		problem = "layer size differs from SGL_Config.textureSize, rebuild the pack";
+	// Bound every term by the file size first, so none of the sums below can wrap
+	else if (count == 0 || layerBytes > file.size || count > file.size / layerBytes ||
+			 dataOffset > file.size ||
+			 dataOffset < sizeof(header) + (Uint64)count * sizeof(SGL_PackEntry) ||
+			 count * layerBytes > file.size - dataOffset)
+		problem = "truncated";
+	else if ((int)count > sgl.freeTextureCount + (sgl.maxTextures - sgl.nextTextureLayer))
+		problem = "not enough free texture layers";
+	if (problem) {
+		SGL_Error("Texture pack %s: %s", path, problem);
+		sgl_UnmapFile(&file);
+		SGL_TRACE_END("sgl_LoadTexturePack");
+		return NULL;
+	}
+
+	SGL_TexturePack* pack = (SGL_TexturePack*)SDL_calloc(1, sizeof(SGL_TexturePack));
+	SDL_GPUTransferBufferCreateInfo tbufInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = (Uint32)(SDL_min(count, SGL_TEXTURE_PACK_CHUNK) * layerBytes),
+	};
+	SDL_GPUTransferBuffer* tbuf = NULL;
+	if (pack) {
+		pack->textures = (SGL_Texture*)SDL_calloc(count, sizeof(SGL_Texture));
+		pack->entries = (SGL_PackEntry*)SDL_malloc(count * sizeof(SGL_PackEntry));
+		tbuf = SDL_CreateGPUTransferBuffer(sgl.device, &tbufInfo);
+	}
+
+	// Grow the array once for the whole pack instead of doubling per texture
+	int newLayers = (int)count - sgl.freeTextureCount;
+	bool ok = pack && pack->textures && pack->entries && tbuf &&
+			  (newLayers <= 0 || sgl.nextTextureLayer + newLayers <= sgl.textureLayerCapacity ||
+			   sgl_GrowTextureArray(sgl.nextTextureLayer + newLayers));
+	if (!ok) {
+		SGL_Error("Failed to load texture pack %s: %s", path, SDL_GetError());
+		if (tbuf)
+			SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+		sgl_DestroyTexturePack(pack);
+		sgl_UnmapFile(&file);
+		SGL_TRACE_END("sgl_LoadTexturePack");
+		return NULL;
+	}
+
+	SDL_memcpy(pack->entries, file.data + sizeof(header), count * sizeof(SGL_PackEntry));
+	for (Uint32 i = 0; i < count; i++) {
+		SGL_PackEntry* entry = &pack->entries[i];
+		entry->name[SGL_PACK_NAME_MAX - 1] = '\0';
+		entry->width = SDL_Swap32LE(entry->width);
+		entry->height = SDL_Swap32LE(entry->height);
+		entry->offset = SDL_Swap64LE(entry->offset);
+		if (entry->offset > file.size - layerBytes)
+			entry->offset = dataOffset + i * layerBytes; // corrupt entry, fall back to entry order
+
+		pack->textures[i].id = sgl_AllocTextureLayer();
+		pack->textures[i].width = (f32)entry->width;
+		pack->textures[i].height = (f32)entry->height;
+		pack->count++;
+	}
+
+	// Pages of the file go straight into the transfer buffer, SGL_TEXTURE_PACK_CHUNK layers at a
+	// time. Cycling keeps the previous fill alive for the uploads already recorded.
+	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+	bool uploaded = true;
+	for (Uint32 first = 0; first < count; first += SGL_TEXTURE_PACK_CHUNK) {
+		Uint32 n = SDL_min(count - first, SGL_TEXTURE_PACK_CHUNK);
+		Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, tbuf, first > 0);
+		if (!map) {
+			SGL_Error("Failed to map the texture pack transfer buffer: %s", SDL_GetError());
+			uploaded = false;
+			break;
+		}
+		for (Uint32 i = 0; i < n; i++)
+			SDL_memcpy(map + i * layerBytes, file.data + pack->entries[first + i].offset, layerBytes);
+		SDL_UnmapGPUTransferBuffer(sgl.device, tbuf);
+
+		SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
+		for (Uint32 i = 0; i < n; i++) {
+			SDL_GPUTextureTransferInfo source = {
+				.transfer_buffer = tbuf,
+				.offset = (Uint32)(i * layerBytes),
+				.pixels_per_row = layerSize,
+				.rows_per_layer = layerSize,
+			};
+			SDL_GPUTextureRegion dest = {
+				.texture = sgl.globalTextureArray,
+				.layer = (Uint32)pack->textures[first + i].id,
+				.w = layerSize,
+				.h = layerSize,
+				.d = 1,
+			};
+			SDL_UploadToGPUTexture(copyPass, &source, &dest, false);
+		}
+		SDL_EndGPUCopyPass(copyPass);
+		sgl.stats.textureBytesUploaded += n * layerBytes;
+	}
+	SDL_SubmitGPUCommandBuffer(cmd);
+	SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+	sgl_UnmapFile(&file);
+
+	// Some layers never got their pixels, give them all back
+	if (!uploaded) {
+		sgl_DestroyTexturePack(pack);
+		SGL_TRACE_END("sgl_LoadTexturePack");
+		return NULL;
+	}
+
+	SGL_Log("Texture pack %s: %u textures", path, count);
+	SGL_TRACE_END("sgl_LoadTexturePack");
+	return pack;
+}
+
+void sgl_DestroyTexturePack(SGL_TexturePack* pack) {
+	if (!pack)
+		return;
+	for (int i = 0; i < pack->count; i++)
+		sgl_FreeTextureLayer(pack->textures[i].id);
+	SDL_free(pack->textures);
+	SDL_free(pack->entries);
+	SDL_free(pack);
+}
+
+int sgl_GetTexturePackCount(const SGL_TexturePack* pack) { return pack ? pack->count : 0; }
+
+SGL_Texture* sgl_GetPackTexture(SGL_TexturePack* pack, int index) {
+	if (!pack || index < 0 || index >= pack->count)
+		return NULL;
+	return &pack->textures[index];
+}
+
+SGL_Texture* sgl_FindPackTexture(SGL_TexturePack* pack, const char* name) {
+	if (!pack || !name)
+		return NULL;
+	for (int i = 0; i < pack->count; i++) {
+		if (SDL_strcmp(pack->entries[i].name, name) == 0)
+			return &pack->textures[i];
+	}
+	return NULL;
+}
+
+// --- Render Textures ---
+
+SGL_RenderTexture* sgl_CreateRenderTexture(int width, int height) {
+	if (width <= 0 || height <= 0 || width > sgl.textureSize || height > sgl.textureSize) {
+		SGL_Error("Render texture size must be 1..%d (got %dx%d)", sgl.textureSize, width, height);
+		return NULL;
+	}
+
+	int layer = sgl_AllocTextureLayer();
+	if (layer < 0)
+		return NULL;
+
+	SGL_RenderTexture* target = (SGL_RenderTexture*)SDL_calloc(1, sizeof(SGL_RenderTexture));
+	if (!target) {
+		sgl_FreeTextureLayer(layer);
+		return NULL;
+	}
+
+	target->texture.id = layer;
+	target->texture.width = (f32)width;
+	target->texture.height = (f32)height;
+	target->dirty = true;
+	return target;
+}
+
+void sgl_DestroyRenderTexture(SGL_RenderTexture* target) {
+	if (!target)
+		return;
+	if (sgl.renderTarget == target)
+		sgl_EndTextureMode();
+	sgl_FreeTextureLayer(target->texture.id);
+	SDL_free(target);
+}
+
+// The texture array stays bound for sampling while drawing, so render textures are drawn
+// into a separate color texture and copied into their layer at sgl_EndTextureMode
+static bool sgl_EnsureRenderTargets(void) {
+	if (sgl.renderTargetColor && sgl.renderTargetDepth)
+		return true;
+
+	SDL_GPUTextureCreateInfo colorInfo = {
+		.type = SDL_GPU_TEXTURETYPE_2D,
+		.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
+		.width = sgl.textureSize,
+		.height = sgl.textureSize,
+		.layer_count_or_depth = 1,
+		.num_levels = 1,
+		.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET,
+	};
+	if (!sgl.renderTargetColor)
+		sgl.renderTargetColor = SDL_CreateGPUTexture(sgl.device, &colorInfo);
+	if (!sgl.renderTargetColor) {
+		SGL_Error("Failed to create render texture color buffer: %s", SDL_GetError());
+		return false;
+	}
+
+	SDL_GPUTextureCreateInfo depthInfo = {
+		.type = SDL_GPU_TEXTURETYPE_2D,
+		.format = sgl.depthFormat,
+		.width = sgl.textureSize,
+		.height = sgl.textureSize,
+		.layer_count_or_depth = 1,
+		.num_levels = 1,
+		.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET,
+	};
+	sgl.renderTargetDepth = SDL_CreateGPUTexture(sgl.device, &depthInfo);
+	if (!sgl.renderTargetDepth) {
+		SGL_Error("Failed to create render texture depth buffer: %s", SDL_GetError());
+		return false;
+	}
+	return true;
+}
+
+bool sgl_BeginTextureMode(SGL_RenderTexture* target) {
+	if (!target)
+		return false;
+	if (sgl.renderTarget) {
+		SGL_Warn("sgl_BeginTextureMode called while already rendering to a texture");
+		return false;
+	}
+
+	// Still valid from an earlier frame, the caller can skip its draws
+	if (!target->dirty && target->generation == sgl.textureArrayGeneration)
+		return false;
+
+	if (!sgl.curCmd || !sgl_EnsureRenderTargets())
+		return false;
+
+	if (sgl.instanceCount > 0)
+		sgl_Flush(SGL_FLUSH_TARGET_CHANGE);
+
+	sgl.savedMatrix = sgl.currentMatrix;
+	sgl.savedMode = sgl.currentMode;
+	sgl.savedView = sgl.view;
+	sgl.renderTarget = target;
+	sgl.resolvedPipeline = NULL;
+
+	// Start from a transparent layer so the result can be drawn over anything
+	SDL_GPUColorTargetInfo colorTargetInfo = {
+		.texture = sgl.renderTargetColor,
+		.clear_color = { 0.0f, 0.0f, 0.0f, 0.0f },
+		.load_op = SDL_GPU_LOADOP_CLEAR,
+		.store_op = SDL_GPU_STOREOP_STORE,
+	};
+	SDL_GPUDepthStencilTargetInfo depthTargetInfo = {
+		.texture = sgl.renderTargetDepth,
+		.clear_depth = 1.0f,
+		.load_op = SDL_GPU_LOADOP_CLEAR,
+		.store_op = SDL_GPU_STOREOP_STORE,
+		.cycle = false,
+	};
+	SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(sgl.curCmd, &colorTargetInfo, 1, &depthTargetInfo);
+	SDL_EndGPURenderPass(pass);
+	sgl.stats.renderPasses++;
+	return true;
+}
+
+void sgl_EndTextureMode(void) {
+	if (!sgl.renderTarget)
+		return;
+
+	if (sgl.instanceCount > 0)
+		sgl_Flush(SGL_FLUSH_TARGET_CHANGE);
+
+	// Only the part the render texture covers
+	SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(sgl.curCmd);
+	SDL_GPUTextureLocation src = { .texture = sgl.renderTargetColor };
+	SDL_GPUTextureLocation dst = {
+		.texture = sgl.globalTextureArray,
+		.layer = (Uint32)sgl.renderTarget->texture.id,
+	};
+	SDL_CopyGPUTextureToTexture(
+		copyPass, &src, &dst, (Uint32)sgl.renderTarget->texture.width,
+		(Uint32)sgl.renderTarget->texture.height, 1, false
+	);
+	SDL_EndGPUCopyPass(copyPass);
+
+	sgl.renderTarget->dirty = false;
+	sgl.renderTarget->generation = sgl.textureArrayGeneration;
+	sgl.renderTarget = NULL;
+	sgl.resolvedPipeline = NULL;
+
+	sgl.currentMode = sgl.savedMode;
+	sgl_SetBatchMatrix(sgl.savedMatrix);
+	sgl.view = sgl.savedView;
+}
+
+// --- Tilemaps ---
+
+struct SGL_Tilemap {
+	int width;
+	int height;
+	int tileSize;
+	SGL_Texture* tileset;
+	uint16_t* tiles; // CPU copy, [x + width * y]
+
+	// Each region is one layer of the texture array holding one RGBA8 texel per tile
+	int region; // tiles per region side, the texture size
+	int regionsX;
+	int regionsY;
+	int* layers;	   // index layer per region
+	SDL_Rect* dirty;   // tiles changed since the last upload, w == 0 when clean
+};
+
+static void sgl_MarkTilesDirty(SGL_Tilemap* map, int x, int y, int w, int h) {
+	int region = map->region;
+	int rx0 = x / region, rx1 = (x + w - 1) / region;
+	int ry0 = y / region, ry1 = (y + h - 1) / region;
+
+	for (int ry = ry0; ry <= ry1; ry++) {
+		for (int rx = rx0; rx <= rx1; rx++) {
+			// Clip to the region, in region local tiles
+			int ox = rx * region, oy = ry * region;
+			SDL_Rect r = {
+				SDL_max(x, ox) - ox,
+				SDL_max(y, oy) - oy,
+				SDL_min(x + w, ox + region) - SDL_max(x, ox),
+				SDL_min(y + h, oy + region) - SDL_max(y, oy),
+			};
+
+			SDL_Rect* d = &map->dirty[rx + map->regionsX * ry];
+			if (d->w == 0) {
+				*d = r;
+			} else {
+				int x1 = SDL_max(d->x + d->w, r.x + r.w);
+				int y1 = SDL_max(d->y + d->h, r.y + r.h);
+				d->x = SDL_min(d->x, r.x);
+				d->y = SDL_min(d->y, r.y);
+				d->w = x1 - d->x;
+				d->h = y1 - d->y;
+			}
+		}
+	}
+}
+
+SGL_Tilemap* sgl_CreateTilemap(int width, int height, SGL_Texture* tileset, int tileSize) {
+	if (width <= 0 || height <= 0) {
+		SGL_Error("Tilemap size must be positive (%dx%d)", width, height);
+		return NULL;
+	}
+	if (!tileset || tileSize <= 0 || tileSize > sgl.textureSize) {
+		SGL_Error("Tilemap needs a tileset and a tile size of 1..%d", sgl.textureSize);
+		return NULL;
+	}
+
+	SGL_Tilemap* map = (SGL_Tilemap*)SDL_calloc(1, sizeof(SGL_Tilemap));
+	if (!map)
+		return NULL;
+
+	map->width = width;
+	map->height = height;
+	map->tileSize = tileSize;
+	map->tileset = tileset;
+	map->region = sgl.textureSize;
+	map->regionsX = (width + map->region - 1) / map->region;
+	map->regionsY = (height + map->region - 1) / map->region;
+
+	int regionCount = map->regionsX * map->regionsY;
+	map->tiles = (uint16_t*)SDL_calloc((size_t)width * height, sizeof(uint16_t));
+	map->layers = (int*)SDL_malloc(regionCount * sizeof(int));
+	map->dirty = (SDL_Rect*)SDL_calloc(regionCount, sizeof(SDL_Rect));
+	if (!map->tiles || !map->layers || !map->dirty) {
+		SDL_free(map->tiles);
+		SDL_free(map->layers);
+		SDL_free(map->dirty);
+		SDL_free(map);
+		return NULL;
+	}
+
+	for (int i = 0; i < regionCount; i++) {
+		map->layers[i] = sgl_AllocTextureLayer();
+		if (map->layers[i] < 0) {
+			for (int j = 0; j < i; j++)
+				sgl_FreeTextureLayer(map->layers[j]);
+			SDL_free(map->tiles);
+			SDL_free(map->layers);
+			SDL_free(map->dirty);
+			SDL_free(map);
+			return NULL;
+		}
+	}
+
+	// Recycled layers hold old pixels, the first draw uploads every region
+	sgl_MarkTilesDirty(map, 0, 0, width, height);
+	return map;
+}
+
+void sgl_DestroyTilemap(SGL_Tilemap* map) {
+	if (!map)
+		return;
+	for (int i = 0; i < map->regionsX * map->regionsY; i++)
+		sgl_FreeTextureLayer(map->layers[i]);
+	SDL_free(map->tiles);
+	SDL_free(map->layers);
+	SDL_free(map->dirty);
+	SDL_free(map);
+}
+
+void sgl_SetTile(SGL_Tilemap* map, int x, int y, uint16_t tile) {
+	if (!map || x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return;
+	uint16_t* t = &map->tiles[x + map->width * y];
+	if (*t == tile)
+		return;
+	*t = tile;
+	sgl_MarkTilesDirty(map, x, y, 1, 1);
+}
+
+uint16_t sgl_GetTile(SGL_Tilemap* map, int x, int y) {
+	if (!map || x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return 0;
+	return map->tiles[x + map->width * y];
+}
+
+void sgl_SetTiles(SGL_Tilemap* map, int x, int y, int w, int h, const uint16_t* tiles) {
+	if (!map || !tiles)
+		return;
+
+	// Clip to the map, keeping the source stride
+	int x0 = SDL_max(x, 0), y0 = SDL_max(y, 0);
+	int x1 = SDL_min(x + w, map->width), y1 = SDL_min(y + h, map->height);
+	if (x0 >= x1 || y0 >= y1)
+		return;
+
+	for (int ty = y0; ty < y1; ty++) {
+		SDL_memcpy(&map->tiles[x0 + map->width * ty], &tiles[(x0 - x) + w * (ty - y)],
+			(x1 - x0) * sizeof(uint16_t));
+	}
+	sgl_MarkTilesDirty(map, x0, y0, x1 - x0, y1 - y0);
+}
+
+// Upload the dirty rect of every region in one copy pass, on its own command buffer
+static bool sgl_UploadTilemap(SGL_Tilemap* map) {
+	int regionCount = map->regionsX * map->regionsY;
+	Uint32 size = 0;
+	for (int i = 0; i < regionCount; i++)
+		size += (Uint32)(map->dirty[i].w * map->dirty[i].h) * 4;
+	if (size == 0)
+		return true;
+
+	SDL_GPUTransferBufferCreateInfo tbufInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = size,
+	};
+	SDL_GPUTransferBuffer* tbuf = SDL_CreateGPUTransferBuffer(sgl.device, &tbufInfo);
+	if (!tbuf)
+		return false;
+
+	// Index n >= 1 -> texel (n - 1) split over R and G, alpha marks a filled tile
+	Uint8* map8 = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, tbuf, false);
+	Uint8* p = map8;
+	for (int i = 0; i < regionCount; i++) {
+		SDL_Rect* d = &map->dirty[i];
+		int ox = (i % map->regionsX) * map->region + d->x;
+		int oy = (i / map->regionsX) * map->region + d->y;
+		for (int ty = 0; ty < d->h; ty++) {
+			const uint16_t* row = &map->tiles[ox + map->width * (oy + ty)];
+			for (int tx = 0; tx < d->w; tx++) {
+				uint16_t n = row[tx];
+				p[0] = n ? (Uint8)((n - 1) & 0xFF) : 0;
+				p[1] = n ? (Uint8)((n - 1) >> 8) : 0;
+				p[2] = 0;
+				p[3] = n ? 255 : 0;
+				p += 4;
+			}
+		}
+	}
+	SDL_UnmapGPUTransferBuffer(sgl.device, tbuf);
+
+	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(cmd);
+	Uint32 offset = 0;
+	for (int i = 0; i < regionCount; i++) {
+		SDL_Rect* d = &map->dirty[i];
+		if (d->w == 0)
+			continue;
+
+		SDL_GPUTextureTransferInfo src = {
+			.transfer_buffer = tbuf,
+			.offset = offset,
+			.pixels_per_row = (Uint32)d->w,
+			.rows_per_layer = (Uint32)d->h,
+		};
+		SDL_GPUTextureRegion dst = {
+			.texture = sgl.globalTextureArray,
+			.layer = (Uint32)map->layers[i],
+			.x = (Uint32)d->x,
+			.y = (Uint32)d->y,
+			.w = (Uint32)d->w,
+			.h = (Uint32)d->h,
+			.d = 1,
+		};
+		SDL_UploadToGPUTexture(copy, &src, &dst, false);
+		offset += (Uint32)(d->w * d->h) * 4;
+		*d = (SDL_Rect){ 0 };
+	}
+	SDL_EndGPUCopyPass(copy);
+	SDL_SubmitGPUCommandBuffer(cmd);
+
+	SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+	sgl.stats.textureBytesUploaded += size;
+	return true;
+}
+
+// True when the world rect is entirely outside the current view (2D only)
+static bool sgl_RectOutsideView(f32 x, f32 y, f32 w, f32 h) {
+	const f32* m = sgl.currentMatrix.m;
+	bool left = true, right = true, below = true, above = true;
+	for (int i = 0; i < 4; i++) {
+		f32 px = x + ((i & 1) ? w : 0.0f);
+		f32 py = y + ((i & 2) ? h : 0.0f);
+		f32 cx = m[0] * px + m[4] * py + m[12];
+		f32 cy = m[1] * px + m[5] * py + m[13];
+		f32 cw = m[3] * px + m[7] * py + m[15];
+		if (cw <= 0.0f)
+			return false;
+		left &= cx < -cw;
+		right &= cx > cw;
+		below &= cy < -cw;
+		above &= cy > cw;
+	}
+	return left || right || below || above;
+}
+
+void sgl_DrawTilemap(SGL_Tilemap* map, f32 x, f32 y, f32 tileWorldSize, SGL_COLOR tint) {
+	if (!map)
+		return;
+
+	SGL_TRACE_BEGIN("sgl_DrawTilemap.upload");
+	bool ok = sgl_UploadTilemap(map);
+	SGL_TRACE_END("sgl_DrawTilemap.upload");
+	if (!ok)
+		return;
+
+	int region = map->region;
+	for (int ry = 0; ry < map->regionsY; ry++) {
+		for (int rx = 0; rx < map->regionsX; rx++) {
+			int tilesX = SDL_min(map->width - rx * region, region);
+			int tilesY = SDL_min(map->height - ry * region, region);
+			f32 wx = x + rx * region * tileWorldSize;
+			f32 wy = y + ry * region * tileWorldSize;
+			f32 ww = tilesX * tileWorldSize;
+			f32 wh = tilesY * tileWorldSize;
+
+			if (sgl.currentMode == SGL_BATCH_2D && sgl_RectOutsideView(wx, wy, ww, wh))
+				continue;
+
+			// Region size in tiles goes where the rotation origin would be
+			SGL_InstanceData inst = sgl_MakeInstance(
+				wx, wy, ww, wh, 0, (f32)tilesX, (f32)tilesY, 0.0f, SGL_SHAPE_TILEMAP, tint);
+			inst.texIndex = (f32)map->layers[rx + map->regionsX * ry];
+			inst.p2 = (f32)map->tileset->id;
+			inst.p3 = (f32)map->tileSize;
+			sgl_EmitInstance(&inst);
+		}
+	}
 }
 
 // --- Shader API ---
 
-SDL_GPUShader* sgl_LoadShader(
-	const char* filename,
-	SDL_GPUShaderStage stage,
-	int num_uniform,
-	int num_storage,
-	int num_samplers
-) {
-	size_t codeSize;
-	void* code = SDL_LoadFile(filename, &codeSize);
-	if (!code) {
-		SGL_Error("Shader file not found: %s", filename);
+SDL_GPUShader* sgl_LoadShader(
+	const char* filename,
+	SDL_GPUShaderStage stage,
+	int num_uniform,
+	int num_storage,
+	int num_samplers
+) {
+	size_t codeSize;
+	void* code = SDL_LoadFile(filename, &codeSize);
+	if (!code) {
+		SGL_Error("Shader file not found: %s", filename);
+		return NULL;
+	}
+
+	SDL_GPUShaderCreateInfo shaderInfo = {
+		.code_size = codeSize,
+		.code = (const uint8_t*)code,
+		.entrypoint = "main",
+		.format = SDL_GPU_SHADERFORMAT_SPIRV,
+		.stage = stage,
+		.num_samplers = (Uint32)num_samplers,
+		.num_storage_textures = 0,
+		.num_storage_buffers = (Uint32)num_storage,
+		.num_uniform_buffers = (Uint32)num_uniform,
+	};
+
+	SDL_GPUShader* shader = SDL_CreateGPUShader(sgl.device, &shaderInfo);
+	SDL_free(code);
+
+	if (shader) {
+		SGL_Log(
+			"Loaded Shader '%s' [Stage: %d | Uniforms: %d | Storage: %d]",
+			filename,
+			stage,
+			num_uniform,
+			num_storage
+		);
+	} else {
+		SGL_Error("Failed to create shader from %s", filename);
+	}
+
+	return shader;
+}
+
+static SDL_GPUGraphicsPipeline*
+sgl_BuildPipeline(SDL_GPUShader* vert, SDL_GPUShader* frag, SGL_PipelineState state) {
+
+	SDL_GPUTextureFormat swapFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // texture array
+	if (!(state & SGL_PIPELINE_OFFSCREEN)) {
+		swapFormat = SDL_GetGPUSwapchainTextureFormat(sgl.device, sgl.window);
+		if (swapFormat == SDL_GPU_TEXTUREFORMAT_INVALID) {
+			SGL_Error("Failed to get Swapchain Format! Window might not be claimed.");
+			return NULL;
+		}
+	}
+
+	SDL_GPUColorTargetBlendState blendState = {
+		.enable_blend = true,
+		.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+		.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+		.color_blend_op = SDL_GPU_BLENDOP_ADD,
+		.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
+		.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+		.alpha_blend_op = SDL_GPU_BLENDOP_ADD,
+		.color_write_mask = 0xF,
+	};
+
+	switch (SGL_PIPELINE_BLEND(state)) {
+	case SGL_BLEND_NONE:
+		blendState.enable_blend = false;
+		break;
+	case SGL_BLEND_ADDITIVE:
+		blendState.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+		blendState.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+		break;
+	case SGL_BLEND_MULTIPLY:
+		// dst * mix(1, src, a), the fragment shader has to output premultiplied color
+		blendState.src_color_blendfactor = SDL_GPU_BLENDFACTOR_DST_COLOR;
+		blendState.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+		if (frag == sgl.defaultFrag && sgl.defaultFragMultiply)
+			frag = sgl.defaultFragMultiply;
+		break;
+	default:
+		break;
+	}
+
+	SDL_GPUColorTargetDescription targetDesc = {
+		.format = swapFormat,
+		.blend_state = blendState,
+	};
+
+	SDL_GPUGraphicsPipelineTargetInfo targetInfo = {
+		.num_color_targets = 1,
+		.color_target_descriptions = &targetDesc,
+		.has_depth_stencil_target = true,
+		.depth_stencil_format = sgl.depthFormat,
+	};
+
+	SGL_DepthMode depthMode = SGL_PIPELINE_DEPTH(state);
+	SDL_GPUDepthStencilState depthStencilState = {
+		.enable_depth_test = depthMode != SGL_DEPTH_OFF,
+		.enable_depth_write = depthMode == SGL_DEPTH_READ_WRITE,
+		.compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL,
+	};
+
+	// Cube faces are wound counter-clockwise when seen from outside
+	SGL_CullMode cullMode = SGL_PIPELINE_CULL(state);
+	SDL_GPURasterizerState rasterizerState = {
+		.fill_mode = SDL_GPU_FILLMODE_FILL,
+		.cull_mode = (cullMode == SGL_CULL_BACK)	? SDL_GPU_CULLMODE_BACK
+					 : (cullMode == SGL_CULL_FRONT) ? SDL_GPU_CULLMODE_FRONT
+													: SDL_GPU_CULLMODE_NONE,
+		.front_face = SDL_GPU_FRONTFACE_COUNTER_CLOCKWISE,
+	};
+
+	SDL_GPUGraphicsPipelineCreateInfo pipelineInfo = {
+		.vertex_shader = vert,
+		.fragment_shader = frag,
+		.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+		.rasterizer_state = rasterizerState,
+		.depth_stencil_state = depthStencilState,
+		.target_info = targetInfo,
+	};
+
+	SGL_Log("Creating Graphics Pipeline (state 0x%04x)...", state);
+	SDL_GPUGraphicsPipeline* p = SDL_CreateGPUGraphicsPipeline(sgl.device, &pipelineInfo);
+
+	if (!p) {
+		SGL_Error("Pipeline Creation Failed! Error: %s", SDL_GetError());
+	} else {
+		SGL_Log("Pipeline Created Successfully.");
+	}
+
+	return p;
+}
+
+static bool sgl_RegisterPipelineVariant(
+	SDL_GPUShader* vert,
+	SDL_GPUShader* frag,
+	SGL_PipelineState state,
+	SDL_GPUGraphicsPipeline* pipeline,
+	bool owned
+) {
+	if (sgl.pipelineVariantCount >= SGL_MAX_PIPELINE_VARIANTS) {
+		SGL_Warn("Pipeline variant cache is full! (Max %d)", SGL_MAX_PIPELINE_VARIANTS);
+		return false;
+	}
+
+	sgl.pipelineVariants[sgl.pipelineVariantCount++] = (SGL_PipelineVariant){
+		.vert = vert,
+		.frag = frag,
+		.state = state,
+		.pipeline = pipeline,
+		.owned = owned,
+	};
+	return true;
+}
+
+// Release the shaders handed to sgl_CreatePipelineOwned, each once even if shared by pipelines
+static void sgl_ReleasePipelineShaders(void) {
+	for (int i = 0; i < sgl.pipelineVariantCount; i++) {
+		SGL_PipelineVariant* v = &sgl.pipelineVariants[i];
+		if (!v->ownsShaders)
+			continue;
+
+		bool vertSeen = false, fragSeen = false;
+		for (int j = 0; j < i; j++) {
+			SGL_PipelineVariant* o = &sgl.pipelineVariants[j];
+			if (!o->ownsShaders)
+				continue;
+			vertSeen |= o->vert == v->vert || o->frag == v->vert;
+			fragSeen |= o->vert == v->frag || o->frag == v->frag;
+		}
+		if (!vertSeen)
+			SDL_ReleaseGPUShader(sgl.device, v->vert);
+		if (!fragSeen && v->frag != v->vert)
+			SDL_ReleaseGPUShader(sgl.device, v->frag);
+	}
+}
+
+// Find or lazily create the pipeline for (shaders, state)
+static SDL_GPUGraphicsPipeline*
+sgl_GetPipelineVariant(SDL_GPUShader* vert, SDL_GPUShader* frag, SGL_PipelineState state) {
+	for (int i = 0; i < sgl.pipelineVariantCount; i++) {
+		SGL_PipelineVariant* v = &sgl.pipelineVariants[i];
+		if (v->vert == vert && v->frag == frag && v->state == state)
+			return v->pipeline;
+	}
+
+	if (sgl.pipelineVariantCount >= SGL_MAX_PIPELINE_VARIANTS) {
+		SGL_Warn("Pipeline variant cache is full! (Max %d)", SGL_MAX_PIPELINE_VARIANTS);
+		return NULL;
+	}
+
+	SDL_GPUGraphicsPipeline* p = sgl_BuildPipeline(vert, frag, state);
+	if (p)
+		sgl_RegisterPipelineVariant(vert, frag, state, p, true);
+	return p;
+}
+
+// --- Shader Variants ---
+// default.vert/.frag branch per vertex and fragment on the shape type. Batches that only
+// hold rects (2D) or cubes (3D) are drawn with copies compiled without those branches,
+// selected at flush from what the batch holds. Only replaces the default pipeline.
+
+static const struct {
+	const uint8_t* code;
+	size_t size;
+} sgl_variantShaderCode[SGL_VARIANT_SHADER_COUNT] = {
+	{ variant_quad_vert, sizeof(variant_quad_vert) },
+	{ variant_quad_rotated_vert, sizeof(variant_quad_rotated_vert) },
+	{ variant_cube_vert, sizeof(variant_cube_vert) },
+	{ variant_solid_frag, sizeof(variant_solid_frag) },
+	{ variant_textured_frag, sizeof(variant_textured_frag) },
+};
+
+typedef struct {
+	SGL_BatchMode mode;
+	Uint32 features; // everything this variant can draw
+	SGL_VariantShader vert;
+	SGL_VariantShader frag;
+} SGL_ShaderVariant;
+
+// Cheapest first, the first one covering the whole batch wins
+static const SGL_ShaderVariant sgl_shaderVariants[] = {
+	{ SGL_BATCH_2D, SGL_BATCH_HAS_RECT, SGL_VARIANT_QUAD_VERT, SGL_VARIANT_SOLID_FRAG },
+	{ SGL_BATCH_2D,
+	  SGL_BATCH_HAS_RECT | SGL_BATCH_HAS_TEXTURE,
+	  SGL_VARIANT_QUAD_VERT,
+	  SGL_VARIANT_TEXTURED_FRAG },
+	{ SGL_BATCH_2D,
+	  SGL_BATCH_HAS_RECT | SGL_BATCH_HAS_TEXTURE | SGL_BATCH_HAS_ROTATION,
+	  SGL_VARIANT_QUAD_ROTATED_VERT,
+	  SGL_VARIANT_TEXTURED_FRAG },
+	{ SGL_BATCH_3D, SGL_BATCH_HAS_CUBE | SGL_BATCH_HAS_TEXTURE, SGL_VARIANT_CUBE_VERT, SGL_VARIANT_TEXTURED_FRAG },
+};
+
+static void sgl_ReleaseShaderVariants(void) {
+	for (int i = 0; i < SGL_VARIANT_SHADER_COUNT; i++) {
+		if (sgl.variantShaders[i])
+			SDL_ReleaseGPUShader(sgl.device, sgl.variantShaders[i]);
+		sgl.variantShaders[i] = NULL;
+	}
+}
+
+// Same resource counts as the embedded default shaders
+static bool sgl_LoadShaderVariants(void) {
+	if (sgl.variantShaders[0])
+		return true;
+
+	for (int i = 0; i < SGL_VARIANT_SHADER_COUNT; i++) {
+		bool vertex = i < SGL_VARIANT_SOLID_FRAG;
+		sgl.variantShaders[i] = sgl_CreateShaderFromBytes(
+			sgl_variantShaderCode[i].code,
+			sgl_variantShaderCode[i].size,
+			vertex ? SDL_GPU_SHADERSTAGE_VERTEX : SDL_GPU_SHADERSTAGE_FRAGMENT,
+			vertex ? 1 : 0,
+			vertex ? 1 : 0,
+			vertex ? 0 : 1
+		);
+		if (!sgl.variantShaders[i]) {
+			sgl_ReleaseShaderVariants();
+			return false;
+		}
+	}
+	return true;
+}
+
+bool sgl_SetShaderVariants(bool enable) {
+	sgl.shaderVariantsEnabled = enable;
+	sgl.shaderVariantsFailed = false;
+
+	// Before sgl_InitWindow the shaders are loaded on first use
+	if (enable && sgl.device && !sgl_LoadShaderVariants()) {
+		sgl.shaderVariantsEnabled = false;
+		return false;
+	}
+	return true;
+}
+
+bool sgl_IsShaderVariantsEnabled(void) {
+	return sgl.shaderVariantsEnabled && !sgl.shaderVariantsFailed;
+}
+
+// The variant of `pipeline` for the current batch, or `pipeline` itself
+static SDL_GPUGraphicsPipeline*
+sgl_SpecializePipeline(SDL_GPUGraphicsPipeline* pipeline, SGL_PipelineState state) {
+	// The variant fragment shaders don't premultiply for SGL_BLEND_MULTIPLY
+	if (!sgl.shaderVariantsEnabled || sgl.shaderVariantsFailed ||
+		sgl.activePipeline != sgl.defaultPipeline ||
+		SGL_PIPELINE_BLEND(state) == SGL_BLEND_MULTIPLY)
+		return pipeline;
+
+	if (!sgl_LoadShaderVariants()) {
+		SGL_Warn("Shader variants disabled, the embedded shaders could not be created");
+		sgl.shaderVariantsFailed = true;
+		return pipeline;
+	}
+
+	for (size_t i = 0; i < sizeof(sgl_shaderVariants) / sizeof(sgl_shaderVariants[0]); i++) {
+		const SGL_ShaderVariant* v = &sgl_shaderVariants[i];
+		if (v->mode != sgl.currentMode || (sgl.batchFeatures & ~v->features))
+			continue;
+
+		SDL_GPUGraphicsPipeline* p = sgl_GetPipelineVariant(
+			sgl.variantShaders[v->vert],
+			sgl.variantShaders[v->frag],
+			state
+		);
+		if (!p)
+			return pipeline;
+		sgl.stats.specializedBatches++;
+		return p;
+	}
+	return pipeline;
+}
+
+// The active pipeline with its shaders, switched to `state`
+static SDL_GPUGraphicsPipeline* sgl_PipelineForState(SGL_PipelineState state) {
+	for (int i = 0; i < sgl.pipelineVariantCount; i++) {
+		SGL_PipelineVariant* v = &sgl.pipelineVariants[i];
+		if (v->pipeline == sgl.activePipeline) {
+			if (v->state == state)
+				return v->pipeline;
+			SDL_GPUGraphicsPipeline* p = sgl_GetPipelineVariant(v->vert, v->frag, state);
+			return p ? p : sgl.activePipeline;
+		}
+	}
+
+	// Not made by sgl_CreatePipeline, so we don't know its shaders
+	return sgl.activePipeline;
+}
+
+// Render state plus the target the next pass draws into
+static SGL_PipelineState sgl_CurrentPipelineState(void) {
+	return sgl.pipelineState | (sgl.renderTarget ? SGL_PIPELINE_OFFSCREEN : 0);
+}
+
+// The default fragment shader never discards (that would turn off early-Z for every pipeline
+// built from it), so the transparent pixels around soft edges are drawn too: keep them out of
+// the depth buffer
+static SGL_PipelineState sgl_SoftEdgeState(SGL_PipelineState state) {
+	if (SGL_PIPELINE_DEPTH(state) != SGL_DEPTH_READ_WRITE)
+		return state;
+	SGL_PipelineState readOnly =
+		SGL_PIPELINE_STATE(SGL_PIPELINE_BLEND(state), SGL_DEPTH_READ_ONLY, SGL_PIPELINE_CULL(state));
+	return readOnly | (state & SGL_PIPELINE_OFFSCREEN);
+}
+
+// Pipeline bound at flush time: the active pipeline adjusted to the current render state
+static SDL_GPUGraphicsPipeline* sgl_ResolvePipeline(void) {
+	SGL_PipelineState state = sgl_CurrentPipelineState();
+	if (state == 0)
+		return sgl.activePipeline;
+	if (!sgl.resolvedPipeline)
+		sgl.resolvedPipeline = sgl_PipelineForState(state);
+	return sgl.resolvedPipeline;
+}
+
+SDL_GPUGraphicsPipeline* sgl_CreatePipeline(SDL_GPUShader* vert, SDL_GPUShader* frag) {
+	if (!vert || !frag) {
+		SGL_Error("sgl_CreatePipeline needs a vertex and a fragment shader");
+		return NULL;
+	}
+
+	SDL_GPUGraphicsPipeline* p = sgl_BuildPipeline(vert, frag, 0);
+	// The caller owns it, we only remember its shaders to derive state variants
+	if (p)
+		sgl_RegisterPipelineVariant(vert, frag, 0, p, false);
+	return p;
+}
+
+SDL_GPUGraphicsPipeline* sgl_CreatePipelineOwned(SDL_GPUShader* vert, SDL_GPUShader* frag) {
+	if (!vert || !frag) {
+		SGL_Error("sgl_CreatePipelineOwned needs a vertex and a fragment shader");
+		return NULL;
+	}
+
+	// The caller owns the pipeline, sgl owns the shaders from here on
+	SDL_GPUGraphicsPipeline* p = sgl_BuildPipeline(vert, frag, 0);
+	if (p && sgl_RegisterPipelineVariant(vert, frag, 0, p, false)) {
+		sgl.pipelineVariants[sgl.pipelineVariantCount - 1].ownsShaders = true;
+		return p;
+	}
+
+	// Not cached, so no variant will ever need them
+	SDL_ReleaseGPUShader(sgl.device, vert);
+	SDL_ReleaseGPUShader(sgl.device, frag);
+	return p;
+}
+
+// --- Camera ---
+
+void sgl_SetMouseLock(bool lock) { SDL_SetWindowRelativeMouseMode(sgl.window, lock); }
+
+void sgl_SetCamera(SGL_Camera* cam) {
+	if (cam) {
+		sgl.camera = *cam;
+	} else {
+		sgl.camera = (SGL_Camera){
+			0.0f,
+			1.0f,
+		};
+	}
+}
+
+void sgl_CameraInit(SGL_Camera* cam, f32 x, f32 y, f32 zoom) {
+	cam->x = x;
+	cam->y = y;
+	cam->zoom = (zoom <= 0.0f) ? 1.0f : zoom;
+}
+
+// 2D Camera controller update things
+void sgl_CameraUpdate(SGL_Camera* cam) {
+	const bool* key = SDL_GetKeyboardState(NULL);
+	float speed = 5.0f;
+
+	if (key[SDL_SCANCODE_LSHIFT])
+		speed += 3.0f;
+	if (key[SDL_SCANCODE_W])
+		cam->y -= speed;
+	if (key[SDL_SCANCODE_A])
+		cam->x -= speed;
+	if (key[SDL_SCANCODE_S])
+		cam->y += speed;
+	if (key[SDL_SCANCODE_D])
+		cam->x += speed;
+	if (key[SDL_SCANCODE_Q])
+		cam->zoom -= 0.05f;
+	if (key[SDL_SCANCODE_E])
+		cam->zoom += 0.05f;
+
+	if (cam->zoom < 0.1f)
+		cam->zoom = 0.1f;
+}
+
+// 3D Camera Controller
+void sgl_Camera3DUpdate(SGL_Camera3D* cam, SGL_CAMERA_MODE mode, f32 deltaTime) {
+	const f32 CAMERA_SPEED = cam->speed;
+	const f32 MOUSE_SENSITIVITY = 0.003f;
+
+	float mouseX, mouseY;
+	SDL_GetRelativeMouseState(&mouseX, &mouseY);
+
+	if (mode == CAMERA_FREE) {
+		// Calculte direction vector (Target - Position)
+		Vec3 forward = sgl_Vec3Sub(cam->target, cam->position);
+		f32 dist = sgl_Vec3length(forward);
+		forward = sgl_Vec3Normalize(forward);
+
+		// Calculate Yaw and Pitch
+		f32 yaw = atan2f(forward.z, forward.x);
+		f32 pitch = asinf(forward.y);
+
+		// Apply mouse deltas
+		yaw += mouseX * MOUSE_SENSITIVITY;
+		pitch -= mouseY * MOUSE_SENSITIVITY;
+
+		// Clamp pitch
+		if (pitch > 1.55f)
+			pitch = 1.55f;
+		if (pitch < -1.55f)
+			pitch = -1.55f;
+
+		// Reconstruct forward vector from the new Yaw/Pitch
+		forward.x = cosf(pitch) * cosf(yaw);
+		forward.y = sinf(pitch);
+		forward.z = cosf(pitch) * sinf(yaw);
+		forward = sgl_Vec3Normalize(forward);
+
+		// update target based on position and new direction
+		cam->target = sgl_Vec3Add(cam->position, sgl_Vec3Scale(forward, dist));
+
+		// update target based on position and new direction
+		const bool* keys = SDL_GetKeyboardState(NULL);
+		Vec3 moveDir = { 0, 0, 0 };
+
+		// Recalculate forward/right vectors for movement
+		// ignoring the "right" vector so we move along the floor plane
+		Vec3 right = sgl_Vec3Cross(forward, cam->up);
+		right = sgl_Vec3Normalize(right);
+
+		f32 speed = CAMERA_SPEED * deltaTime;
+		if (keys[SDL_SCANCODE_LSHIFT])
+			speed *= 3.0f; // sprint
+
+		if (keys[SDL_SCANCODE_W])
+			moveDir = sgl_Vec3Add(moveDir, forward);
+		if (keys[SDL_SCANCODE_S])
+			moveDir = sgl_Vec3Sub(moveDir, forward);
+		if (keys[SDL_SCANCODE_A])
+			moveDir = sgl_Vec3Sub(moveDir, right);
+		if (keys[SDL_SCANCODE_D])
+			moveDir = sgl_Vec3Add(moveDir, right);
+
+		// Fly up/Down (Space/Ctrl)
+		if (keys[SDL_SCANCODE_E])
+			moveDir.y += 1.0f;
+		if (keys[SDL_SCANCODE_Q])
+			moveDir.y -= 1.0f;
+
+		// apply movement
+		cam->position = sgl_Vec3Add(cam->position, sgl_Vec3Scale(moveDir, speed));
+		cam->target = sgl_Vec3Add(cam->target, sgl_Vec3Scale(moveDir, speed));
+
+	} else
+
+		if (mode == CAMERA_ORBITAL) {
+		const f32 PAN_SPEED = 5.0f * deltaTime;
+		const f32 ZOOM_SPEED = 0.5f;
+
+		// Calculate Direction
+		Vec3 dir = sgl_Vec3Sub(cam->position, cam->target);
+		f32 dist = sgl_Vec3length(dir);
+		dir = sgl_Vec3Normalize(dir);
+
+		// Mouse Scroll
+		f32 scroll = sgl_GetMouseWheelY();
+		if (scroll != 0.0f) {
+			const f32 ZOOM_FACTOR = 0.2f;
+
+			dist -= (dist * scroll * ZOOM_FACTOR);
+
+			if (dist < 0.5f) {
+				dist = 0.5f;
+			}
+			if (dist > 100.0f) {
+				dist = 100.0f;
+			}
+		}
+
+		// Calculate current yaw and pitch
+		f32 yaw = atan2f(dir.z, dir.x);
+		f32 pitch = asinf(dir.y);
+
+		// Apply Mouse Rotation
+		yaw += mouseX * MOUSE_SENSITIVITY;
+		pitch -= mouseY * MOUSE_SENSITIVITY;
+
+		// yaw -= mouseX * MOUSE_SENSITIVITY;
+		// pitch += mouseY * MOUSE_SENSITIVITY;
+
+		// Clamp Pitch
+		if (pitch > 1.55f)
+			pitch = 1.55f;
+		if (pitch < -1.55f)
+			pitch = -1.55f;
+
+		// reconstruct new direction vector
+		dir.x = cosf(pitch) * cosf(yaw);
+		dir.y = sinf(pitch);
+		dir.z = cosf(pitch) * sinf(yaw);
+		dir = sgl_Vec3Normalize(dir);
+
+		// WASD Panning
+		const bool* keys = SDL_GetKeyboardState(NULL);
+		Vec3 moveDir = { 0, 0, 0 };
+
+		// Calculate flat forward vector
+		Vec3 flatForward = { -dir.x, 0.0f, -dir.z };
+		flatForward = sgl_Vec3Normalize(flatForward);
+		Vec3 right = sgl_Vec3Cross(flatForward, cam->up);
+		right = sgl_Vec3Normalize(right);
+
+		f32 speed = PAN_SPEED;
+		if (keys[SDL_SCANCODE_LSHIFT])
+			speed *= 3.0f; // Fast pan
+
+		if (keys[SDL_SCANCODE_W])
+			moveDir = sgl_Vec3Add(moveDir, flatForward);
+		if (keys[SDL_SCANCODE_S])
+			moveDir = sgl_Vec3Sub(moveDir, flatForward);
+		if (keys[SDL_SCANCODE_A])
+			moveDir = sgl_Vec3Sub(moveDir, right);
+		if (keys[SDL_SCANCODE_D])
+			moveDir = sgl_Vec3Add(moveDir, right);
+
+		// Apply panning to the TARGET
+		cam->target = sgl_Vec3Add(cam->target, sgl_Vec3Scale(moveDir, speed));
+
+		// Fly Up/Down (Pans target up and down)
+		if (keys[SDL_SCANCODE_SPACE])
+			cam->target.y += speed;
+		if (keys[SDL_SCANCODE_LCTRL])
+			cam->target.y -= speed;
+
+		// Snap camera position back to the outside of the orbit sphere
+		cam->position = sgl_Vec3Add(cam->target, sgl_Vec3Scale(dir, dist));
+	}
+}
+
+// --- Frame Pacing ---
+
+static bool sgl_ApplyPresentMode(void) {
+	if (!SDL_WindowSupportsGPUPresentMode(sgl.device, sgl.window, sgl.presentMode)) {
+		SGL_Warn("Present mode %d is not supported, falling back to VSYNC", sgl.presentMode);
+		sgl.presentMode = SDL_GPU_PRESENTMODE_VSYNC;
+	}
+
+	if (!SDL_SetGPUSwapchainParameters(
+			sgl.device,
+			sgl.window,
+			SDL_GPU_SWAPCHAINCOMPOSITION_SDR,
+			sgl.presentMode
+		)) {
+		SGL_Error("Failed to set swapchain parameters: %s", SDL_GetError());
+		return false;
+	}
+	return true;
+}
+
+bool sgl_SetPresentMode(SDL_GPUPresentMode mode) {
+	sgl.presentMode = mode;
+	if (!sgl.device)
+		return true; // applied in sgl_InternalInit
+
+	return sgl_ApplyPresentMode() && sgl.presentMode == mode;
+}
+
+bool sgl_SetFramesInFlight(int frames) {
+	if (frames < 1 || frames > 3) {
+		SGL_Error("Frames in flight must be between 1 and 3 (got %d)", frames);
+		return false;
+	}
+
+	sgl.framesInFlight = frames;
+	if (!sgl.device)
+		return true;
+
+	if (!SDL_SetGPUAllowedFramesInFlight(sgl.device, (Uint32)frames)) {
+		SGL_Error("Failed to set frames in flight: %s", SDL_GetError());
+		return false;
+	}
+	return true;
+}
+
+void sgl_SetNonBlockingAcquire(bool enable) { sgl.nonBlockingAcquire = enable; }
+
+void sgl_SetTargetFPS(int fps) {
+	sgl.framePeriod = (fps > 0) ? SDL_GetPerformanceFrequency() / (uint64_t)fps : 0;
+}
+
+f64 sgl_GetFrameTime(void) { return sgl.lastStats.frameMs / 1000.0; }
+
+// Sleep until shortly before the deadline, then spin for the rest. The margin is how
+// much sleeps have been observed to overshoot (mean + one standard deviation), so it
+// adapts to the OS timer and spinning stays well under a millisecond per frame.
+static void sgl_WaitForNextFrame(void) {
+	if (!sgl.framePeriod)
+		return;
+
+	uint64_t start = SDL_GetPerformanceCounter();
+	uint64_t deadline = sgl.frameMark + sgl.framePeriod;
+	if (!sgl.frameMark || start >= deadline)
+		return; // late frames are not caught up, the next one starts from now
+
+	if (sgl.oversleepMeanMs <= 0.0)
+		sgl.oversleepMeanMs = 1.0; // pessimistic until measured
+
+	SGL_TRACE_BEGIN("sgl_EndDrawing.limit");
+	for (;;) {
+		uint64_t now = SDL_GetPerformanceCounter();
+		if (now >= deadline)
+			break;
+		// Capped so a few scheduler hiccups can't turn the limiter into a busy loop
+		f64 marginMs = SDL_min(sgl.oversleepMeanMs + sqrt(sgl.oversleepVarMs), 2.0);
+		f64 sleepMs = sgl_PerfToMs(deadline - now) - marginMs;
+		if (sleepMs < 0.1)
+			break;
+
+		SDL_DelayNS((Uint64)(sleepMs * SDL_NS_PER_MS));
+		f64 delta = sgl_PerfToMs(SDL_GetPerformanceCounter() - now) - sleepMs - sgl.oversleepMeanMs;
+		sgl.oversleepMeanMs += 0.05 * delta;
+		sgl.oversleepVarMs = 0.95 * (sgl.oversleepVarMs + 0.05 * delta * delta);
+	}
+	while (SDL_GetPerformanceCounter() < deadline) {
+		SDL_CPUPauseInstruction();
+	}
+	SGL_TRACE_END("sgl_EndDrawing.limit");
+
+	sgl.stats.limiterWaitMs = sgl_PerfToMs(SDL_GetPerformanceCounter() - start);
+}
+
+// --- Fixed Timestep ---
+
+void sgl_FixedStepInit(SGL_FixedStep* fs, f64 updatesPerSecond) {
+	if (!fs)
+		return;
+	if (updatesPerSecond <= 0.0) {
+		SGL_Warn("sgl_FixedStepInit: rate must be positive (got %f), using 60", updatesPerSecond);
+		updatesPerSecond = 60.0;
+	}
+	fs->step = 1.0 / updatesPerSecond;
+	fs->maxFrame = 0.25;
+	fs->accumulator = 0.0;
+}
+
+void sgl_FixedStepAdvance(SGL_FixedStep* fs, f64 frameTime) {
+	if (!fs)
+		return;
+	if (frameTime < 0.0)
+		frameTime = 0.0;
+	if (frameTime > fs->maxFrame)
+		frameTime = fs->maxFrame;
+	fs->accumulator += frameTime;
+}
+
+bool sgl_FixedStepTick(SGL_FixedStep* fs) {
+	if (!fs || fs->step <= 0.0 || fs->accumulator < fs->step)
+		return false;
+	fs->accumulator -= fs->step;
+	return true;
+}
+
+f32 sgl_FixedStepAlpha(const SGL_FixedStep* fs) {
+	if (!fs || fs->step <= 0.0)
+		return 0.0f;
+	return (f32)(fs->accumulator / fs->step);
+}
+
+// --- Low Power ---
+
+void sgl_SetLowPowerMode(bool enable) {
+	sgl.lowPower = enable;
+	// The first frame after switching is always drawn
+	SDL_SetAtomicInt(&sgl.redrawRequested, 1);
+}
+
+bool sgl_IsLowPowerMode(void) { return sgl.lowPower; }
+
+void sgl_RequestRedraw(void) {
+	if (SDL_SetAtomicInt(&sgl.redrawRequested, 1) || !sgl.lowPower)
+		return; // already pending, or nobody is waiting
+
+	// Wake up SDL_WaitEventTimeout. Registering twice from racing threads only wastes an id.
+	if (!sgl.wakeEvent) {
+		Uint32 type = SDL_RegisterEvents(1);
+		if (!type)
+			return; // picked up by the timeout instead
+		sgl.wakeEvent = type;
+	}
+	SDL_Event e = { .type = sgl.wakeEvent };
+	SDL_PushEvent(&e);
+}
+
+// --- Frame Capture ---
+
+static int sgl_CaptureWorker(void* data) {
+	(void)data;
+	SDL_LockMutex(sgl.captureLock);
+	for (;;) {
+		while (sgl.captureQueueCount == 0 && !sgl.captureQuit)
+			SDL_WaitCondition(sgl.captureWake, sgl.captureLock);
+		if (sgl.captureQueueCount == 0)
+			break; // quit, and nothing left to deliver
+
+		SGL_CaptureSlot* slot = &sgl.captures[sgl.captureQueue[sgl.captureQueueHead]];
+		sgl.captureQueueHead = (sgl.captureQueueHead + 1) % SGL_CAPTURE_RING;
+		sgl.captureQueueCount--;
+		SDL_UnlockMutex(sgl.captureLock);
+
+		slot->callback(&slot->frame, slot->userdata);
+		SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_DONE);
+
+		SDL_LockMutex(sgl.captureLock);
+	}
+	SDL_UnlockMutex(sgl.captureLock);
+	return 0;
+}
+
+static bool sgl_StartCaptureWorker(void) {
+	if (sgl.captureThread)
+		return true;
+
+	sgl.captureLock = SDL_CreateMutex();
+	sgl.captureWake = SDL_CreateCondition();
+	sgl.captureQuit = false;
+	if (sgl.captureLock && sgl.captureWake)
+		sgl.captureThread = SDL_CreateThread(sgl_CaptureWorker, "sgl_capture", NULL);
+	if (!sgl.captureThread) {
+		SGL_Error("Failed to start the capture worker: %s", SDL_GetError());
+		if (sgl.captureWake)
+			SDL_DestroyCondition(sgl.captureWake);
+		if (sgl.captureLock)
+			SDL_DestroyMutex(sgl.captureLock);
+		sgl.captureWake = NULL;
+		sgl.captureLock = NULL;
+		return false;
+	}
+	return true;
+}
+
+// Unmap what the worker is done with, and hand finished downloads to it in frame order.
+// `wait` blocks on the fences instead of leaving unfinished ones for a later frame.
+static void sgl_PollCaptures(bool wait) {
+	for (;;) {
+		SGL_CaptureSlot* oldest = NULL;
+		for (int i = 0; i < SGL_CAPTURE_RING; i++) {
+			SGL_CaptureSlot* slot = &sgl.captures[i];
+			int state = SDL_GetAtomicInt(&slot->state);
+			if (state == SGL_CAPTURE_DONE) {
+				SDL_UnmapGPUTransferBuffer(sgl.device, slot->buffer);
+				SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_FREE);
+			} else if (state == SGL_CAPTURE_IN_FLIGHT &&
+					   (!oldest || slot->frame.frame < oldest->frame.frame)) {
+				oldest = slot;
+			}
+		}
+		if (!oldest)
+			return;
+
+		SDL_GPUFence* fence = oldest->fence;
+		if (wait)
+			SDL_WaitForGPUFences(sgl.device, true, &fence, 1);
+		else if (!SDL_QueryGPUFence(sgl.device, fence))
+			return; // later frames can't be done before this one
+
+		SDL_LockMutex(sgl.captureLock);
+		for (int i = 0; i < SGL_CAPTURE_RING; i++) {
+			SGL_CaptureSlot* slot = &sgl.captures[i];
+			if (SDL_GetAtomicInt(&slot->state) != SGL_CAPTURE_IN_FLIGHT || slot->fence != fence)
+				continue;
+
+			slot->fence = NULL;
+			slot->frame.pixels = SDL_MapGPUTransferBuffer(sgl.device, slot->buffer, false);
+			if (!slot->frame.pixels) {
+				SGL_Error("Failed to map a capture buffer: %s", SDL_GetError());
+				sgl.stats.capturesDropped++;
+				SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_FREE);
+				continue;
+			}
+			SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_WORKER);
+			sgl.captureQueue[(sgl.captureQueueHead + sgl.captureQueueCount) % SGL_CAPTURE_RING] = i;
+			sgl.captureQueueCount++;
+		}
+		SDL_SignalCondition(sgl.captureWake);
+		SDL_UnlockMutex(sgl.captureLock);
+		SDL_ReleaseGPUFence(sgl.device, fence);
+	}
+}
+
+static bool sgl_RequestCapture(SGL_RenderTexture* target, SGL_CaptureCallback callback, void* userdata) {
+	if (!callback) {
+		SGL_Error("Capture needs a callback");
+		return false;
+	}
+	if (!sgl_StartCaptureWorker())
+		return false;
+
+	sgl_PollCaptures(false);
+	for (int i = 0; i < SGL_CAPTURE_RING; i++) {
+		SGL_CaptureSlot* slot = &sgl.captures[i];
+		if (SDL_GetAtomicInt(&slot->state) != SGL_CAPTURE_FREE)
+			continue;
+		slot->target = target;
+		slot->callback = callback;
+		slot->userdata = userdata;
+		SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_REQUESTED);
+		return true;
+	}
+
+	// Every buffer is still on the GPU or with the callback: drop rather than stall
+	sgl.stats.capturesDropped++;
+	return false;
+}
+
+bool sgl_CaptureFrameAsync(SGL_CaptureCallback callback, void* userdata) {
+	return sgl_RequestCapture(NULL, callback, userdata);
+}
+
+// The target must stay alive until sgl_EndDrawing, its content at that point is captured
+bool sgl_CaptureRenderTextureAsync(SGL_RenderTexture* target, SGL_CaptureCallback callback, void* userdata) {
+	if (!target) {
+		SGL_Error("sgl_CaptureRenderTextureAsync needs a render texture");
+		return false;
+	}
+	return sgl_RequestCapture(target, callback, userdata);
+}
+
+static bool sgl_EnsureCaptureBuffer(SGL_CaptureSlot* slot, Uint32 size) {
+	if (slot->buffer && slot->bufferSize >= size)
+		return true;
+	if (slot->buffer)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, slot->buffer);
+
+	SDL_GPUTransferBufferCreateInfo info = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD,
+		.size = size,
+	};
+	slot->buffer = SDL_CreateGPUTransferBuffer(sgl.device, &info);
+	slot->bufferSize = slot->buffer ? size : 0;
+	if (!slot->buffer)
+		SGL_Error("Failed to create a %u byte capture buffer", size);
+	return slot->buffer != NULL;
+}
+
+// Copies every requested capture into its download buffer, after the last flush of the frame.
+// Returns true when the frame's command buffer needs a fence.
+static bool sgl_RecordCaptures(void) {
+	SDL_GPUCopyPass* copyPass = NULL;
+	for (int i = 0; i < SGL_CAPTURE_RING; i++) {
+		SGL_CaptureSlot* slot = &sgl.captures[i];
+		if (SDL_GetAtomicInt(&slot->state) != SGL_CAPTURE_REQUESTED)
+			continue;
+
+		SGL_CaptureFrame* frame = &slot->frame;
+		SDL_GPUTextureRegion src = { .d = 1 };
+		if (slot->target) {
+			src.texture = sgl.globalTextureArray;
+			src.layer = (Uint32)slot->target->texture.id;
+			frame->width = (int)slot->target->texture.width;
+			frame->height = (int)slot->target->texture.height;
+			frame->format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+		} else {
+			src.texture = sgl.swapchainTex; // NULL on skipped frames
+			frame->width = (int)sgl.swapchainW;
+			frame->height = (int)sgl.swapchainH;
+			frame->format = SDL_GetGPUSwapchainTextureFormat(sgl.device, sgl.window);
+		}
+		frame->pitch = frame->width * (int)SDL_GPUTextureFormatTexelBlockSize(frame->format);
+		frame->frame = sgl.frameCount;
+		frame->pixels = NULL;
+
+		Uint32 size = (Uint32)(frame->pitch * frame->height);
+		if (!src.texture || size == 0 || !sgl_EnsureCaptureBuffer(slot, size)) {
+			sgl.stats.capturesDropped++;
+			SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_FREE);
+			continue;
+		}
+
+		src.w = (Uint32)frame->width;
+		src.h = (Uint32)frame->height;
+		SDL_GPUTextureTransferInfo dst = { .transfer_buffer = slot->buffer };
+		if (!copyPass)
+			copyPass = SDL_BeginGPUCopyPass(sgl.curCmd);
+		SDL_DownloadFromGPUTexture(copyPass, &src, &dst);
+
+		slot->fence = NULL; // set once submitted
+		SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_IN_FLIGHT);
+	}
+	if (!copyPass)
+		return false;
+	SDL_EndGPUCopyPass(copyPass);
+	return true;
+}
+
+static void sgl_SubmitFrame(void) {
+	if (!sgl_RecordCaptures()) {
+		SDL_SubmitGPUCommandBuffer(sgl.curCmd);
+		return;
+	}
+
+	SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(sgl.curCmd);
+	for (int i = 0; i < SGL_CAPTURE_RING; i++) {
+		SGL_CaptureSlot* slot = &sgl.captures[i];
+		if (SDL_GetAtomicInt(&slot->state) != SGL_CAPTURE_IN_FLIGHT || slot->fence)
+			continue;
+		slot->fence = fence;
+		if (!fence) {
+			sgl.stats.capturesDropped++;
+			SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_FREE);
+		}
+	}
+}
+
+void sgl_FlushCaptures(void) {
+	if (!sgl.captureThread)
+		return;
+
+	sgl_PollCaptures(true);
+	for (;;) {
+		bool busy = false;
+		for (int i = 0; i < SGL_CAPTURE_RING; i++)
+			busy = busy || SDL_GetAtomicInt(&sgl.captures[i].state) == SGL_CAPTURE_WORKER;
+		if (!busy)
+			break;
+		SDL_Delay(1);
+	}
+	sgl_PollCaptures(false);
+}
+
+static void sgl_ReleaseCaptures(void) {
+	if (sgl.captureThread) {
+		sgl_FlushCaptures();
+		SDL_LockMutex(sgl.captureLock);
+		sgl.captureQuit = true;
+		SDL_SignalCondition(sgl.captureWake);
+		SDL_UnlockMutex(sgl.captureLock);
+		SDL_WaitThread(sgl.captureThread, NULL);
+		SDL_DestroyCondition(sgl.captureWake);
+		SDL_DestroyMutex(sgl.captureLock);
+		sgl.captureThread = NULL;
+		sgl.captureWake = NULL;
+		sgl.captureLock = NULL;
+	}
+	for (int i = 0; i < SGL_CAPTURE_RING; i++) {
+		SGL_CaptureSlot* slot = &sgl.captures[i];
+		if (slot->buffer)
+			SDL_ReleaseGPUTransferBuffer(sgl.device, slot->buffer);
+		slot->buffer = NULL;
+		slot->bufferSize = 0;
+		SDL_SetAtomicInt(&slot->state, SGL_CAPTURE_FREE); // requests never recorded are dropped
+	}
+}
+
+// --- Init/Shutdown ---
+
+static bool sgl_InternalInit(SDL_Window* window, SDL_GPUDevice* device, const SGL_Config* config) {
+	sgl.device = device;
+	sgl.window = window;
+	sgl.maxInstances = config->maxInstances;
+	sgl.textureSize = config->textureSize;
+	sgl.maxTextures = config->maxTextures;
+	sgl.occlusionCapacity = (Uint32)sgl.maxInstances * SGL_OCCLUSION_BATCHES;
+
+	sgl.depthFormat = config->depthFormat;
+	if (!SDL_GPUTextureSupportsFormat(device, sgl.depthFormat, SDL_GPU_TEXTURETYPE_2D,
+									  SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET)) {
+		SGL_Warn("Depth format %d is not supported, falling back to D16_UNORM", sgl.depthFormat);
+		sgl.depthFormat = SDL_GPU_TEXTUREFORMAT_D16_UNORM;
+	}
+
+	// Check and Log Backend
+	const char* backend = SDL_GetGPUDeviceDriver(sgl.device);
+	SGL_Log("SGL Initialized. Graphics Backend: %s", backend);
+
+	SDL_ClaimWindowForGPUDevice(device, window);
+	SDL_GetWindowSizeInPixels(sgl.window, &sgl.winW, &sgl.winH);
+
+	// Frame pacing from the config, or requested before init
+	if (config->presentMode != SDL_GPU_PRESENTMODE_VSYNC)
+		sgl.presentMode = config->presentMode;
+	if (config->framesInFlight > 0)
+		sgl.framesInFlight = config->framesInFlight;
+	if (sgl.presentMode != SDL_GPU_PRESENTMODE_VSYNC)
+		sgl_ApplyPresentMode();
+	if (sgl.framesInFlight > 0)
+		sgl_SetFramesInFlight(sgl.framesInFlight);
+
+	SDL_GPUSamplerCreateInfo samplerInfo = {
+		.min_filter = config->textureFilter,
+		.mag_filter = config->textureFilter,
+		.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
+		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
+	};
+	sgl.defaultSampler = SDL_CreateGPUSampler(sgl.device, &samplerInfo);
+
+	// Start small, sgl_CreateTexture grows the array when it runs out of layers
+	sgl.nextTextureLayer = 0;
+	sgl.textureLayerCapacity = 0;
+	sgl.globalTextureBinding.sampler = sgl.defaultSampler;
+	sgl.freeTextureLayers = (int*)SDL_malloc(sgl.maxTextures * sizeof(int));
+	sgl.freeTextureCount = 0;
+	sgl.opaqueLayers = (bool*)SDL_calloc(sgl.maxTextures, sizeof(bool));
+	if (!sgl.freeTextureLayers || !sgl.opaqueLayers) {
+		SGL_Error("Failed to allocate the texture layer free list");
+		return false;
+	}
+	sgl_GrowTextureArray(config->initialTextureLayers);
+
+	SDL_GPUBufferCreateInfo bInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+		.size = sgl.maxInstances * sizeof(SGL_InstanceData),
+	};
+	sgl.instanceBuffer = SDL_CreateGPUBuffer(device, &bInfo);
+
+	SDL_GPUTransferBufferCreateInfo tInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = sgl.maxInstances * sizeof(SGL_InstanceData),
+	};
+	sgl.transferBuffer = SDL_CreateGPUTransferBuffer(device, &tInfo);
+
+	// Cache line aligned, so whole instances stream out with aligned stores
+	sgl.staging = (SGL_InstanceData*)SDL_aligned_alloc(64, sgl.maxInstances * sizeof(SGL_InstanceData));
+	sgl.sortKeys = (SGL_SortKey*)SDL_malloc(sgl.maxInstances * sizeof(SGL_SortKey));
+	if (!sgl.instanceBuffer || !sgl.transferBuffer) {
+		SGL_Error("Failed to create the instance buffers (%d instances)", sgl.maxInstances);
+		return false;
+	}
+	if (!sgl.staging || !sgl.sortKeys) {
+		SGL_Error("Failed to allocate the instance staging buffers");
+		return false;
+	}
+
+	// LOAD DEFAULT SHADERS
+	SGL_Log("Load Default Shaders");
+	// Vertex shaders
+	SGL_Log("Load Default Vertex Shaders");
+	SDL_GPUShader* v = sgl_CreateShaderFromBytes(
+		default_vert,
+		sizeof(default_vert),
+		SDL_GPU_SHADERSTAGE_VERTEX,
+		1,
+		1,
+		0
+	);
+
+	// Fragment shaders
+	SGL_Log("Load Default Fragment Shaders");
+	SDL_GPUShader* f = sgl_CreateShaderFromBytes(
+		default_frag,
+		sizeof(default_frag),
+		SDL_GPU_SHADERSTAGE_FRAGMENT,
+		0,
+		0,
+		1
+	);
+	SDL_GPUShader* fm = sgl_CreateShaderFromBytes(
+		default_frag_multiply,
+		sizeof(default_frag_multiply),
+		SDL_GPU_SHADERSTAGE_FRAGMENT,
+		0,
+		0,
+		1
+	);
+
+	if (v && f && fm) {
+		// Shaders stay alive so render state variants can be built later
+		sgl.defaultVert = v;
+		sgl.defaultFrag = f;
+		sgl.defaultFragMultiply = fm;
+		sgl.defaultPipeline = sgl_GetPipelineVariant(v, f, 0);
+		sgl.activePipeline = sgl.defaultPipeline;
+	} else {
+		SGL_Error("Failed to load embedded default shaders.");
+		if (v)
+			SDL_ReleaseGPUShader(sgl.device, v);
+		if (f)
+			SDL_ReleaseGPUShader(sgl.device, f);
+		if (fm)
+			SDL_ReleaseGPUShader(sgl.device, fm);
+		return false;
+	}
+
+	// Check if the depthbuffer or the window size is changing
+	sgl_CheckResize();
+
+	return true;
+}
+
+SGL_Config sgl_DefaultConfig(void) {
+	SGL_Config config = {
+		.width = 800,
+		.height = 600,
+		.title = "SGL",
+		.windowFlags = SDL_WINDOW_RESIZABLE,
+		.maxInstances = SGL_MAX_INSTANCES,
+		.textureSize = SGL_TEXTURE_SIZE,
+		.maxTextures = SGL_MAX_TEXTURES,
+		.initialTextureLayers = SGL_TEXTURE_INITIAL_LAYERS,
+		.depthFormat = SDL_GPU_TEXTUREFORMAT_D16_UNORM,
+		.textureFilter = SDL_GPU_FILTER_NEAREST,
+		.presentMode = SDL_GPU_PRESENTMODE_VSYNC,
+		.framesInFlight = 0,
+		.gpuDriver = NULL,
+		.gpuDebug = true,
+	};
+	return config;
+}
+
+bool sgl_InitEx(const SGL_Config* config) {
+#ifdef SGL_ENABLE_TRACE
+	sgl_trace.baseTicks = SDL_GetPerformanceCounter();
+#endif
+
+	SDL_SetLogOutputFunction(sgl_LogOutputFunction, NULL);
+
+	SDL_SetLogPriority(SGL_LOG_CATEGORY, SDL_LOG_PRIORITY_INFO);
+
+	SGL_Config cfg = config ? *config : sgl_DefaultConfig();
+	if (cfg.maxInstances <= 0 || cfg.textureSize <= 0 || cfg.maxTextures <= 0) {
+		SGL_Error("Invalid config: maxInstances, textureSize and maxTextures must be positive");
+		return false;
+	}
+	cfg.initialTextureLayers = SDL_clamp(cfg.initialTextureLayers, 1, cfg.maxTextures);
+
+	if (!SDL_Init(SDL_INIT_VIDEO)) {
+		SGL_Error("SDL_Init failed: %s", SDL_GetError());
+		return false;
+	}
+	SDL_Window* win = SDL_CreateWindow(cfg.title, cfg.width, cfg.height, cfg.windowFlags);
+	if (!win) {
+		SGL_Error("Failed to create the window: %s", SDL_GetError());
+		return false;
+	}
+
+	// The embedded shaders are SPIR-V, so only drivers taking SPIR-V (Vulkan by default) work
+	SDL_GPUDevice* dev = SDL_CreateGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV, cfg.gpuDebug, cfg.gpuDriver);
+	if (!dev) {
+		SGL_Error("Failed to create the GPU device: %s", SDL_GetError());
+		SDL_DestroyWindow(win);
+		return false;
+	}
+
+	if (!sgl_InternalInit(win, dev, &cfg)) {
+		// Releases whatever was created so far, the device and the window
+		sgl_Shutdown();
+		return false;
+	}
+	return true;
+}
+
+void sgl_InitWindow(int w, int h, const char* title) {
+	SGL_Config config = sgl_DefaultConfig();
+	config.width = w;
+	config.height = h;
+	config.title = title;
+	if (!sgl_InitEx(&config))
+		SGL_Error("sgl_InitWindow failed, nothing can be drawn");
+}
+
+// Also cleans up after a failed sgl_InitEx, so everything released is reset
+void sgl_Shutdown() {
+	sgl_ReleaseCaptures();
+	if (sgl.instanceBuffer)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.instanceBuffer);
+	if (sgl.transferBuffer)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.transferBuffer);
+	sgl.instanceBuffer = NULL;
+	sgl.transferBuffer = NULL;
+	SDL_aligned_free(sgl.staging);
+	sgl.staging = NULL;
+	sgl_ReleaseOcclusionResources();
+	if (sgl.particlePipeline)
+		SDL_ReleaseGPUComputePipeline(sgl.device, sgl.particlePipeline);
+	if (sgl.particleArgsReset)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.particleArgsReset);
+	sgl.particlePipeline = NULL;
+	sgl.particleArgsReset = NULL;
+	if (sgl.lineBuffer)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.lineBuffer);
+	if (sgl.lineTransfer)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.lineTransfer);
+	sgl.lineBuffer = NULL;
+	sgl.lineTransfer = NULL;
+	sgl.lineCapacity = 0;
+	SDL_free(sgl.sortKeys);
+	sgl.sortKeys = NULL;
+	SDL_free(sgl.freeTextureLayers);
+	sgl.freeTextureLayers = NULL;
+	SDL_free(sgl.opaqueLayers);
+	sgl.opaqueLayers = NULL;
+	// Handles die with the texture array
+	while (sgl.textureEntries) {
+		SGL_TextureEntry* next = sgl.textureEntries->next;
+		SDL_free(sgl.textureEntries->pixels);
+		SDL_free(sgl.textureEntries->path);
+		SDL_free(sgl.textureEntries);
+		sgl.textureEntries = next;
+	}
+	// Owned variants include the default pipeline
+	for (int i = 0; i < sgl.pipelineVariantCount; i++) {
+		if (sgl.pipelineVariants[i].owned)
+			SDL_ReleaseGPUGraphicsPipeline(sgl.device, sgl.pipelineVariants[i].pipeline);
+	}
+	sgl_ReleasePipelineShaders();
+	sgl.pipelineVariantCount = 0;
+	if (sgl.defaultVert)
+		SDL_ReleaseGPUShader(sgl.device, sgl.defaultVert);
+	if (sgl.defaultFrag)
+		SDL_ReleaseGPUShader(sgl.device, sgl.defaultFrag);
+	if (sgl.defaultFragMultiply)
+		SDL_ReleaseGPUShader(sgl.device, sgl.defaultFragMultiply);
+	sgl.defaultVert = NULL;
+	sgl.defaultFrag = NULL;
+	sgl.defaultFragMultiply = NULL;
+	sgl.defaultPipeline = NULL;
+	sgl.activePipeline = NULL;
+	sgl.resolvedPipeline = NULL;
+	sgl_ReleaseShaderVariants();
+
+	if (sgl.globalTextureArray) {
+		SDL_ReleaseGPUTexture(sgl.device, sgl.globalTextureArray);
+		sgl.globalTextureArray = NULL;
+	}
+	sgl.textureLayerCapacity = 0;
+	sgl.nextTextureLayer = 0;
+
+	if (sgl.defaultSampler) {
+		SGL_Warn("Sampler texture was not cleaned up manually (Fixed automatically).");
+		SDL_ReleaseGPUSampler(sgl.device, sgl.defaultSampler);
+		sgl.defaultSampler = NULL;
+	}
+
+	if (sgl.depthTexture) {
+		SGL_Warn("Depth texture was not cleaned up manually (Fixed automatically).");
+		SDL_ReleaseGPUTexture(sgl.device, sgl.depthTexture);
+		sgl.depthTexture = NULL;
+	}
+
+	if (sgl.renderTargetColor) {
+		SDL_ReleaseGPUTexture(sgl.device, sgl.renderTargetColor);
+		sgl.renderTargetColor = NULL;
+	}
+	if (sgl.renderTargetDepth) {
+		SDL_ReleaseGPUTexture(sgl.device, sgl.renderTargetDepth);
+		sgl.renderTargetDepth = NULL;
+	}
+
+	SDL_DestroyGPUDevice(sgl.device);
+	SDL_DestroyWindow(sgl.window);
+	sgl.device = NULL;
+	sgl.window = NULL;
+	SDL_Quit();
+	SGL_Log("Shutdowning gracefully..");
+}
+
+// --- Pipeline Switching ---
+
+void sgl_SetPipeline(SDL_GPUGraphicsPipeline* pipeline) {
+	SDL_GPUGraphicsPipeline* next = pipeline ? pipeline : sgl.defaultPipeline;
+	if (next == sgl.activePipeline)
+		return;
+
+	// The batch so far was recorded for the previous pipeline
+	sgl_Flush(SGL_FLUSH_STATE_CHANGE);
+	sgl.activePipeline = next;
+	sgl.resolvedPipeline = NULL;
+}
+
+static void sgl_SetPipelineState(SGL_PipelineState state) {
+	if (state == sgl.pipelineState)
+		return;
+
+	sgl_Flush(SGL_FLUSH_STATE_CHANGE);
+	sgl.pipelineState = state;
+	sgl.resolvedPipeline = NULL;
+}
+
+void sgl_SetBlendMode(SGL_BlendMode mode) {
+	SGL_PipelineState s = sgl.pipelineState;
+	sgl_SetPipelineState(
+		SGL_PIPELINE_STATE(mode, SGL_PIPELINE_DEPTH(s), SGL_PIPELINE_CULL(s))
+	);
+}
+
+void sgl_SetDepthMode(SGL_DepthMode mode) {
+	SGL_PipelineState s = sgl.pipelineState;
+	sgl_SetPipelineState(
+		SGL_PIPELINE_STATE(SGL_PIPELINE_BLEND(s), mode, SGL_PIPELINE_CULL(s))
+	);
+}
+
+void sgl_SetCullMode(SGL_CullMode mode) {
+	SGL_PipelineState s = sgl.pipelineState;
+	sgl_SetPipelineState(
+		SGL_PIPELINE_STATE(SGL_PIPELINE_BLEND(s), SGL_PIPELINE_DEPTH(s), mode)
+	);
+}
+
+SDL_GPUGraphicsPipeline* sgl_GetDefaultPipeline(void) { return sgl.defaultPipeline; }
+
+// --- Drawing ---
+
+// Draw Shapes
+void sgl_DrawRectangle(f32 x, f32 y, f32 w, f32 h, SGL_COLOR color) {
+	sgl_PushInstance(x, y, w, h, 0, 0, 0, -99.0f, SGL_SHAPE_RECT, color);
+}
+
+void sgl_DrawRectanglePro(Rectangle rec, Vec2 origin, f32 rotation, SGL_COLOR color) {
+	sgl_PushInstance(
+		rec.x,
+		rec.y,
+		rec.w,
+		rec.h,
+		rotation,
+		origin.x,
+		origin.y,
+		0,
+		SGL_SHAPE_RECT,
+		color
+	);
+}
+
+void sgl_DrawTriangle(f32 x, f32 y, f32 size, SGL_COLOR color) {
+	sgl_PushInstance(x, y, size, size, 0, size / 2, size / 2, 0, SGL_SHAPE_TRIG, color);
+}
+
+void sgl_DrawCircle(f32 x, f32 y, f32 radius, SGL_COLOR color) {
+	f32 diameter = radius * 2.0f;
+	sgl_PushInstance(
+		x - radius,
+		y - radius,
+		diameter,
+		diameter,
+		0,
+		0,
+		0,
+		0,
+		SGL_SHAPE_CIRCLE,
+		color
+	);
+}
+
+void sgl_DrawRectangleRounded(f32 x, f32 y, f32 w, f32 h, f32 radius, SGL_COLOR color) {
+	SGL_InstanceData inst = sgl_MakeInstance(x, y, w, h, 0, 0, 0, 0, SGL_SHAPE_ROUNDED_RECT, color);
+	inst.p2 = radius;
+	sgl_EmitInstance(&inst);
+}
+
+void sgl_DrawRing(f32 x, f32 y, f32 radius, f32 thickness, SGL_COLOR color) {
+	f32 diameter = radius * 2.0f;
+	SGL_InstanceData inst =
+		sgl_MakeInstance(x - radius, y - radius, diameter, diameter, 0, 0, 0, 0, SGL_SHAPE_RING, color);
+	inst.p2 = thickness;
+	sgl_EmitInstance(&inst);
+}
+
+// The quad is rotated to the middle of the arc, the shader only knows the half aperture
+void sgl_DrawArc(f32 x, f32 y, f32 radius, f32 startAngle, f32 endAngle, f32 thickness, SGL_COLOR color) {
+	f32 diameter = radius * 2.0f;
+	SGL_InstanceData inst = sgl_MakeInstance(
+		x, y, diameter, diameter, (startAngle + endAngle) * 0.5f, radius, radius, 0, SGL_SHAPE_ARC, color
+	);
+	inst.p2 = thickness;
+	inst.p3 = SDL_min(SDL_fabsf(endAngle - startAngle) * 0.5f, SDL_PI_F); // full ring at most
+	sgl_EmitInstance(&inst);
+}
+
+// Segments are expanded from gl_VertexIndex, the instance only holds the endpoints
+void sgl_DrawLine(f32 x0, f32 y0, f32 x1, f32 y1, f32 thickness, SGL_COLOR color) {
+	SGL_InstanceData inst = sgl_MakeInstance(x0, y0, x1, y1, 0, 0, 0, 0, SGL_SHAPE_LINE, color);
+	inst.p3 = thickness;
+	sgl_EmitInstance(&inst);
+}
+
+static bool sgl_EnsureLineBuffer(Uint32 size) {
+	if (sgl.lineCapacity >= size)
+		return true;
+
+	if (sgl.lineBuffer)
+		SDL_ReleaseGPUBuffer(sgl.device, sgl.lineBuffer);
+	if (sgl.lineTransfer)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.lineTransfer);
+	sgl.lineCapacity = 0;
+
+	Uint32 capacity = SDL_max(size, 64 * 1024);
+	capacity = SDL_max(capacity, size + size / 2); // room to grow without reallocating each frame
+
+	SDL_GPUBufferCreateInfo bInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+		.size = capacity,
+	};
+	sgl.lineBuffer = SDL_CreateGPUBuffer(sgl.device, &bInfo);
+
+	SDL_GPUTransferBufferCreateInfo tInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = capacity,
+	};
+	sgl.lineTransfer = SDL_CreateGPUTransferBuffer(sgl.device, &tInfo);
+
+	if (!sgl.lineBuffer || !sgl.lineTransfer) {
+		SGL_Error("Failed to create polyline buffer (%u bytes): %s", capacity, SDL_GetError());
+		return false;
+	}
+	sgl.lineCapacity = capacity;
+	return true;
+}
+
+void sgl_DrawPolyline(const Vec2* points, int count, f32 thickness, SGL_COLOR color) {
+	if (!points || count < 2)
+		return;
+
+	// Short ones join the batch as single segments
+	if (count - 1 <= SGL_POLYLINE_BATCH_MAX || sgl.currentMode != SGL_BATCH_2D) {
+		for (int i = 0; i < count - 1; i++)
+			sgl_DrawLine(points[i].x, points[i].y, points[i + 1].x, points[i + 1].y, thickness, color);
+		return;
+	}
+
+	// Long ones: one header instance followed by the points, one upload, one draw
+	sgl_Flush(SGL_FLUSH_RETAINED);
+	if (!sgl.curCmd || (sgl.frameSkipped && !sgl.renderTarget))
+		return;
+
+	Uint32 pointBytes = (Uint32)count * sizeof(Vec2);
+	Uint32 size = sizeof(SGL_InstanceData) + pointBytes;
+	if (!sgl_EnsureLineBuffer(size))
+		return;
+
+	SGL_TRACE_BEGIN("sgl_DrawPolyline.upload");
+	SGL_InstanceData header = sgl_MakeInstance(0, 0, 0, 0, 0, 0, 0, 0, SGL_SHAPE_LINE, color);
+	header.p2 = (f32)count;
+	header.p3 = thickness;
+
+	Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, sgl.lineTransfer, true);
+	SDL_memcpy(map, &header, sizeof(header));
+	SDL_memcpy(map + sizeof(header), points, pointBytes);
+	SDL_UnmapGPUTransferBuffer(sgl.device, sgl.lineTransfer);
+
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(sgl.curCmd);
+	SDL_GPUTransferBufferLocation src = { .transfer_buffer = sgl.lineTransfer, .offset = 0 };
+	SDL_GPUBufferRegion dst = { .buffer = sgl.lineBuffer, .offset = 0, .size = size };
+	SDL_UploadToGPUBuffer(copy, &src, &dst, true);
+	SDL_EndGPUCopyPass(copy);
+	SGL_TRACE_END("sgl_DrawPolyline.upload");
+
+	// Lines have soft edges
+	SGL_PipelineState state = sgl_SoftEdgeState(sgl_CurrentPipelineState());
+	SDL_GPUGraphicsPipeline* pipeline = sgl_PipelineForState(state);
+	if (!pipeline)
+		return;
+
+	sgl.stats.instances++;
+	sgl.stats.instanceBytesUploaded += size;
+	sgl_DrawInstances(sgl.lineBuffer, 6 * (Uint32)(count - 1), 1, pipeline, &sgl.currentMatrix);
+}
+
+// 3D Object
+void sgl_DrawCube(Vec3 position, f32 size, SGL_Texture* texture, SGL_COLOR color) {
+	// Determine texture index: -1.0f means "no texture"
+	float texIndex = (texture != NULL) ? (float)texture->id : -1.0f;
+
+	// We reuse the existing struct.
+	// x,y,w = position, h = size.
+	// type = generic cube type (define a new enum SGL_SHAPE_CUBE = 100)
+
+	SGL_InstanceData inst = {
+		.x = position.x,
+		.y = position.y,
+		.w = position.z, // Pos X, Y, Z
+		.h = size,		 // Size
+		.angle = 0,
+		.ox = 0,
+		.oy = 0,
+		.z = 0,			// Unused/Rotation
+		.type = 100.0f, // Magic number for CUBE in shader
+		.texIndex = texIndex,
+		.r = color.r / 255.0f,
+		.g = color.g / 255.0f,
+		.b = color.b / 255.0f,
+		.a = color.a / 255.0f,
+	};
+	sgl_EmitInstance(&inst);
+}
+
+// --- Voxel Chunks ---
+
+#define SGL_SHAPE_VOXEL_FACE 101.0f // Magic number for a voxel face in shader
+
+struct SGL_VoxelChunk {
+	int size[3];
+	uint8_t* blocks;
+	SGL_VoxelMaterial palette[256];
+	bool greedy;
+	bool dirty; // blocks or palette changed since the last mesh
+
+	SGL_InstanceData* faces; // CPU side of the last mesh
+	Uint32 faceCount;
+	Uint32 faceCapacity;
+
+	SDL_GPUBuffer* buffer; // GPU side, reused until the mesh outgrows it
+	Uint32 bufferCapacity;
+};
+
+SGL_VoxelChunk* sgl_CreateVoxelChunk(int sizeX, int sizeY, int sizeZ) {
+	if (sizeX <= 0 || sizeY <= 0 || sizeZ <= 0) {
+		SGL_Error("Voxel chunk size must be positive (%dx%dx%d)", sizeX, sizeY, sizeZ);
 		return NULL;
 	}
 
-	SDL_GPUShaderCreateInfo shaderInfo = {
-		.code_size = codeSize,
-		.code = (const uint8_t*)code,
-		.entrypoint = "main",
-		.format = SDL_GPU_SHADERFORMAT_SPIRV,
-		.stage = stage,
-		.num_samplers = (Uint32)num_samplers,
-		.num_storage_textures = 0,
-		.num_storage_buffers = (Uint32)num_storage,
-		.num_uniform_buffers = (Uint32)num_uniform,
+	SGL_VoxelChunk* chunk = (SGL_VoxelChunk*)SDL_calloc(1, sizeof(SGL_VoxelChunk));
+	if (!chunk)
+		return NULL;
+
+	chunk->size[0] = sizeX;
+	chunk->size[1] = sizeY;
+	chunk->size[2] = sizeZ;
+	chunk->blocks = (uint8_t*)SDL_calloc((size_t)sizeX * sizeY * sizeZ, 1);
+	if (!chunk->blocks) {
+		SDL_free(chunk);
+		return NULL;
+	}
+
+	for (int i = 0; i < 256; i++)
+		chunk->palette[i].color = (SGL_COLOR){ 255, 255, 255, 255 };
+
+	chunk->greedy = true;
+	chunk->dirty = true;
+	return chunk;
+}
+
+void sgl_DestroyVoxelChunk(SGL_VoxelChunk* chunk) {
+	if (!chunk)
+		return;
+	if (chunk->buffer)
+		SDL_ReleaseGPUBuffer(sgl.device, chunk->buffer);
+	SDL_free(chunk->faces);
+	SDL_free(chunk->blocks);
+	SDL_free(chunk);
+}
+
+void sgl_SetVoxelChunkBlocks(SGL_VoxelChunk* chunk, const uint8_t* blocks) {
+	if (!chunk || !blocks)
+		return;
+	SDL_memcpy(chunk->blocks, blocks, (size_t)chunk->size[0] * chunk->size[1] * chunk->size[2]);
+	chunk->dirty = true;
+}
+
+void sgl_SetVoxelChunkBlock(SGL_VoxelChunk* chunk, int x, int y, int z, uint8_t block) {
+	if (!chunk || x < 0 || y < 0 || z < 0 || x >= chunk->size[0] || y >= chunk->size[1] ||
+		z >= chunk->size[2])
+		return;
+
+	uint8_t* b = &chunk->blocks[x + chunk->size[0] * (y + chunk->size[1] * z)];
+	if (*b != block) {
+		*b = block;
+		chunk->dirty = true;
+	}
+}
+
+void sgl_SetVoxelChunkPalette(SGL_VoxelChunk* chunk, const SGL_VoxelMaterial* palette, int count) {
+	if (!chunk || !palette)
+		return;
+	if (count > 256)
+		count = 256;
+	SDL_memcpy(chunk->palette, palette, (size_t)count * sizeof(SGL_VoxelMaterial));
+	chunk->dirty = true;
+}
+
+void sgl_SetVoxelChunkGreedy(SGL_VoxelChunk* chunk, bool greedy) {
+	if (!chunk || chunk->greedy == greedy)
+		return;
+	chunk->greedy = greedy;
+	chunk->dirty = true;
+}
+
+uint32_t sgl_GetVoxelChunkFaceCount(SGL_VoxelChunk* chunk) {
+	if (!chunk)
+		return 0;
+	return chunk->faceCount;
+}
+
+static bool sgl_PushVoxelFace(
+	SGL_VoxelChunk* chunk,
+	int axis,
+	bool positive,
+	const int pos[3],
+	const int ext[3],
+	uint8_t block
+) {
+	if (chunk->faceCount == chunk->faceCapacity) {
+		Uint32 cap = chunk->faceCapacity ? chunk->faceCapacity * 2 : 256;
+		SGL_InstanceData* faces =
+			(SGL_InstanceData*)SDL_realloc(chunk->faces, cap * sizeof(SGL_InstanceData));
+		if (!faces) {
+			SGL_Error("Out of memory while meshing voxel chunk");
+			return false;
+		}
+		chunk->faces = faces;
+		chunk->faceCapacity = cap;
+	}
+
+	// Face order of cubeVerts in the shader: +Z, -Z, +Y, -Y, +X, -X
+	static const int faceOf[3][2] = { { 5, 4 }, { 3, 2 }, { 1, 0 } };
+
+	const SGL_VoxelMaterial* mat = &chunk->palette[block];
+	SGL_Texture* tex = mat->side;
+	if (axis == 1)
+		tex = positive ? mat->top : mat->bottom;
+
+	// x,y,w = min corner, ox,oy,z = extent in blocks, p2,p3 = texture repeats along u/v
+	chunk->faces[chunk->faceCount++] = (SGL_InstanceData){
+		.x = (f32)pos[0],
+		.y = (f32)pos[1],
+		.w = (f32)pos[2],
+		.h = 1.0f,
+		.angle = (f32)faceOf[axis][positive],
+		.ox = (f32)ext[0],
+		.oy = (f32)ext[1],
+		.z = (f32)ext[2],
+		.type = SGL_SHAPE_VOXEL_FACE,
+		.texIndex = tex ? (f32)tex->id : -1.0f,
+		.p2 = (f32)((axis == 0) ? ext[2] : ext[0]),
+		.p3 = (f32)((axis == 1) ? ext[2] : ext[1]),
+		.r = mat->color.r / 255.0f,
+		.g = mat->color.g / 255.0f,
+		.b = mat->color.b / 255.0f,
+		.a = mat->color.a / 255.0f,
 	};
+	return true;
+}
 
-	SDL_GPUShader* shader = SDL_CreateGPUShader(sgl.device, &shaderInfo);
-	SDL_free(code);
+// Sweep a plane along each axis and keep only faces between a solid block and air.
+// With greedy on, equal neighbouring faces of a slice are merged into rectangles.
+static bool sgl_MeshVoxelChunk(SGL_VoxelChunk* chunk) {
+	const int* n = chunk->size;
+	int maxSlice = SDL_max(n[0] * n[1], SDL_max(n[1] * n[2], n[0] * n[2]));
 
-	if (shader) {
-		SGL_Log(
-			"Loaded Shader '%s' [Stage: %d | Uniforms: %d | Storage: %d]",
-			filename,
-			stage,
-			num_uniform,
-			num_storage
-		);
-	} else {
-		SGL_Error("Failed to create shader from %s", filename);
+	// +block = face on the positive side of the block before the plane,
+	// -block = face on the negative side of the block after it
+	int* mask = (int*)SDL_malloc((size_t)maxSlice * sizeof(int));
+	if (!mask)
+		return false;
+
+	chunk->faceCount = 0;
+	bool ok = true;
+
+	for (int d = 0; d < 3 && ok; d++) {
+		int u = (d + 1) % 3;
+		int v = (d + 2) % 3;
+		int x[3] = { 0, 0, 0 };
+		int q[3] = { 0, 0, 0 };
+		q[d] = 1;
+
+		for (x[d] = -1; x[d] < n[d] && ok;) {
+			int m = 0;
+			for (x[v] = 0; x[v] < n[v]; x[v]++) {
+				for (x[u] = 0; x[u] < n[u]; x[u]++) {
+					int a = (x[d] >= 0) ? chunk->blocks[x[0] + n[0] * (x[1] + n[1] * x[2])] : 0;
+					int b = (x[d] < n[d] - 1)
+								? chunk->blocks[(x[0] + q[0]) + n[0] * ((x[1] + q[1]) + n[1] * (x[2] + q[2]))]
+								: 0;
+					mask[m++] = (a && !b) ? a : (!a && b) ? -b : 0;
+				}
+			}
+			x[d]++; // plane between slice x[d] - 1 and x[d]
+
+			m = 0;
+			for (int j = 0; j < n[v] && ok; j++) {
+				for (int i = 0; i < n[u];) {
+					int val = mask[m];
+					if (val == 0) {
+						i++;
+						m++;
+						continue;
+					}
+
+					int w = 1;
+					int h = 1;
+					if (chunk->greedy) {
+						while (i + w < n[u] && mask[m + w] == val)
+							w++;
+						for (; j + h < n[v]; h++) {
+							int k = 0;
+							while (k < w && mask[m + k + h * n[u]] == val)
+								k++;
+							if (k < w)
+								break;
+						}
+					}
+
+					int pos[3], ext[3];
+					pos[d] = (val > 0) ? x[d] - 1 : x[d];
+					pos[u] = i;
+					pos[v] = j;
+					ext[d] = 1;
+					ext[u] = w;
+					ext[v] = h;
+					if (!sgl_PushVoxelFace(chunk, d, val > 0, pos, ext, (uint8_t)SDL_abs(val))) {
+						ok = false;
+						break;
+					}
+
+					for (int l = 0; l < h; l++)
+						for (int k = 0; k < w; k++)
+							mask[m + k + l * n[u]] = 0;
+					i += w;
+					m += w;
+				}
+			}
+		}
 	}
 
-	return shader;
+	SDL_free(mask);
+	return ok;
 }
 
-SDL_GPUGraphicsPipeline* sgl_CreatePipeline(SDL_GPUShader* vert, SDL_GPUShader* frag) {
+static bool sgl_UploadVoxelChunk(SGL_VoxelChunk* chunk) {
+	if (chunk->faceCount == 0)
+		return true;
+
+	Uint32 size = chunk->faceCount * sizeof(SGL_InstanceData);
+
+	if (chunk->bufferCapacity < chunk->faceCount) {
+		if (chunk->buffer)
+			SDL_ReleaseGPUBuffer(sgl.device, chunk->buffer);
+
+		SDL_GPUBufferCreateInfo bInfo = {
+			.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+			.size = size,
+		};
+		chunk->buffer = SDL_CreateGPUBuffer(sgl.device, &bInfo);
+		chunk->bufferCapacity = chunk->buffer ? chunk->faceCount : 0;
+		if (!chunk->buffer) {
+			SGL_Error("Failed to create voxel chunk buffer: %s", SDL_GetError());
+			return false;
+		}
+	}
+
+	SDL_GPUTransferBufferCreateInfo tbufInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = size,
+	};
+	SDL_GPUTransferBuffer* tbuf = SDL_CreateGPUTransferBuffer(sgl.device, &tbufInfo);
+	if (!tbuf)
+		return false;
+
+	void* map = SDL_MapGPUTransferBuffer(sgl.device, tbuf, false);
+	SDL_memcpy(map, chunk->faces, size);
+	SDL_UnmapGPUTransferBuffer(sgl.device, tbuf);
+
+	// Own command buffer, submitted before the frame's one so the draw sees the data
+	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(cmd);
+	SDL_GPUTransferBufferLocation src = { .transfer_buffer = tbuf, .offset = 0 };
+	SDL_GPUBufferRegion dst = { .buffer = chunk->buffer, .offset = 0, .size = size };
+	SDL_UploadToGPUBuffer(copy, &src, &dst, false);
+	SDL_EndGPUCopyPass(copy);
+	SDL_SubmitGPUCommandBuffer(cmd);
+
+	SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+	sgl.stats.instanceBytesUploaded += size;
+	return true;
+}
+
+void sgl_DrawVoxelChunk(SGL_VoxelChunk* chunk, Vec3 origin, f32 blockSize) {
+	if (!chunk)
+		return;
+
+	if (sgl.currentMode != SGL_BATCH_3D) {
+		SGL_Warn("sgl_DrawVoxelChunk called outside sgl_BeginMode3D");
+		return;
+	}
+
+	if (chunk->dirty) {
+		SGL_TRACE_BEGIN("sgl_DrawVoxelChunk.mesh");
+		bool ok = sgl_MeshVoxelChunk(chunk) && sgl_UploadVoxelChunk(chunk);
+		SGL_TRACE_END("sgl_DrawVoxelChunk.mesh");
+		if (!ok)
+			return;
+		chunk->dirty = false;
+	}
+
+	if (chunk->faceCount == 0)
+		return;
+
+	// Draw what is batched so far first, the chunk is drawn straight from its own buffer
+	sgl_Flush(SGL_FLUSH_RETAINED);
+	if (sgl.frameSkipped && !sgl.renderTarget)
+		return;
+
+	SGL_Matrix model = sgl_MatIndentity();
+	model.m[0] = blockSize;
+	model.m[5] = blockSize;
+	model.m[10] = blockSize;
+	model.m[12] = origin.x;
+	model.m[13] = origin.y;
+	model.m[14] = origin.z;
+	SGL_Matrix mvp = sgl_MatMultiply(sgl.currentMatrix, model);
+
+	// Faces are always opaque and single sided
+	SGL_PipelineState state =
+		SGL_PIPELINE_STATE(SGL_BLEND_NONE, SGL_PIPELINE_DEPTH(sgl.pipelineState), SGL_CULL_BACK) |
+		(sgl_CurrentPipelineState() & SGL_PIPELINE_OFFSCREEN);
+	SDL_GPUGraphicsPipeline* pipeline = sgl_GetPipelineVariant(sgl.defaultVert, sgl.defaultFrag, state);
+	if (!pipeline)
+		return;
+
+	sgl.stats.instances += chunk->faceCount;
+	sgl_DrawInstances(chunk->buffer, 6, chunk->faceCount, pipeline, &mvp);
+}
+
+// --- Particles ---
+// Particle state never leaves the GPU. Every update runs one compute dispatch that
+// spawns, moves and ages the particles and appends the live ones as instances.
+// The draw is indirect, its instance count is written by the dispatch.
+
+// Uniforms of particles.comp
+typedef struct {
+	f32 emitter[4];	 // position.xy, velocity.xy
+	f32 motion[4];	 // velocityRandom.xy, gravity.xy
+	f32 colorStart[4];
+	f32 colorEnd[4];
+	f32 shape[4]; // sizeStart, sizeEnd, lifetime, lifetimeRandom
+	f32 frame[4]; // dt, texIndex
+	Uint32 emit[4]; // first slot, count, capacity, seed
+} SGL_ParticleParams;
+
+// Matches struct Particle in particles.comp
+typedef struct {
+	f32 x, y, vx, vy;
+	f32 age, lifetime, pad[2];
+} SGL_Particle;
+
+struct SGL_ParticleSystem {
+	SGL_ParticleConfig config;
+	Uint32 capacity;
+	Uint32 nextSlot; // emission wraps around and replaces the oldest particles
+	Uint32 seed;
+	Uint32 burst;
+	f32 emitAccum; // fractional particles carried to the next update
+	bool simulated;
+
+	SDL_GPUBuffer* particles;
+	SDL_GPUBuffer* instances; // live particles as SGL_InstanceData
+	SDL_GPUBuffer* drawArgs;  // SDL_GPUIndirectDrawCommand
+};
+
+static bool sgl_CreateParticleResources(void) {
+	if (sgl.particlePipeline)
+		return true;
+	if (sgl.particleFailed)
+		return false;
+
+	sgl.particlePipeline = sgl_LoadComputePipeline(
+		SGL_SHADER_DIR "particles.comp.spv",
+		(SDL_GPUComputePipelineCreateInfo){
+			.num_readwrite_storage_buffers = 3,
+			.num_uniform_buffers = 1,
+			.threadcount_x = 64,
+			.threadcount_y = 1,
+			.threadcount_z = 1,
+		}
+	);
+
+	SDL_GPUTransferBufferCreateInfo resetInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = sizeof(SDL_GPUIndirectDrawCommand),
+	};
+	sgl.particleArgsReset = SDL_CreateGPUTransferBuffer(sgl.device, &resetInfo);
+
+	if (!sgl.particlePipeline || !sgl.particleArgsReset) {
+		if (sgl.particlePipeline)
+			SDL_ReleaseGPUComputePipeline(sgl.device, sgl.particlePipeline);
+		if (sgl.particleArgsReset)
+			SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.particleArgsReset);
+		sgl.particlePipeline = NULL;
+		sgl.particleArgsReset = NULL;
+		sgl.particleFailed = true;
+		SGL_Warn("Particles unavailable, shader in %s could not be loaded", SGL_SHADER_DIR);
+		return false;
+	}
+
+	SDL_GPUIndirectDrawCommand reset = { 6, 0, 0, 0 };
+	void* map = SDL_MapGPUTransferBuffer(sgl.device, sgl.particleArgsReset, false);
+	SDL_memcpy(map, &reset, sizeof(reset));
+	SDL_UnmapGPUTransferBuffer(sgl.device, sgl.particleArgsReset);
+	return true;
+}
+
+static void sgl_ReleaseParticleBuffers(SGL_ParticleSystem* ps) {
+	if (ps->particles)
+		SDL_ReleaseGPUBuffer(sgl.device, ps->particles);
+	if (ps->instances)
+		SDL_ReleaseGPUBuffer(sgl.device, ps->instances);
+	if (ps->drawArgs)
+		SDL_ReleaseGPUBuffer(sgl.device, ps->drawArgs);
+}
 
-	SDL_GPUTextureFormat swapFormat = SDL_GetGPUSwapchainTextureFormat(sgl.device, sgl.window);
-	if (swapFormat == SDL_GPU_TEXTUREFORMAT_INVALID) {
-		SGL_Error("Failed to get Swapchain Format! Window might not be claimed.");
+SGL_ParticleSystem* sgl_CreateParticleSystem(int maxParticles, const SGL_ParticleConfig* config) {
+	if (maxParticles <= 0 || !config) {
+		SGL_Error("Particle system needs a config and a positive capacity (%d)", maxParticles);
 		return NULL;
 	}
+	if (!sgl_CreateParticleResources())
+		return NULL;
 
-	SDL_GPUColorTargetDescription targetDesc = {
-		.format = swapFormat,
-		.blend_state = { 
-      .enable_blend = true,
-		  .src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
-		  .dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-			.color_blend_op = SDL_GPU_BLENDOP_ADD,
-			.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA,
-			.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
-			.alpha_blend_op = SDL_GPU_BLENDOP_ADD,
-			.color_write_mask = 0xF,
-    },
+	SGL_ParticleSystem* ps = (SGL_ParticleSystem*)SDL_calloc(1, sizeof(SGL_ParticleSystem));
+	if (!ps)
+		return NULL;
+	ps->config = *config;
+	ps->capacity = (Uint32)maxParticles;
+
+	SDL_GPUBufferCreateInfo particleInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = ps->capacity * sizeof(SGL_Particle),
 	};
+	ps->particles = SDL_CreateGPUBuffer(sgl.device, &particleInfo);
 
-	SDL_GPUGraphicsPipelineTargetInfo targetInfo = {
-		.num_color_targets = 1,
-		.color_target_descriptions = &targetDesc,
-		.has_depth_stencil_target = true,
-		.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D16_UNORM,
+	SDL_GPUBufferCreateInfo instanceInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = ps->capacity * sizeof(SGL_InstanceData),
 	};
+	ps->instances = SDL_CreateGPUBuffer(sgl.device, &instanceInfo);
 
-	SDL_GPUDepthStencilState depthStencilState = {
-		.enable_depth_test = true,
-		.enable_depth_write = true,
-		.compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL,
+	SDL_GPUBufferCreateInfo argsInfo = {
+		.usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+				 SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE,
+		.size = sizeof(SDL_GPUIndirectDrawCommand),
 	};
+	ps->drawArgs = SDL_CreateGPUBuffer(sgl.device, &argsInfo);
 
-	SDL_GPUGraphicsPipelineCreateInfo pipelineInfo = {
-		.vertex_shader = vert,
-		.fragment_shader = frag,
-		.primitive_type = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
-		.depth_stencil_state = depthStencilState,
-		.target_info = targetInfo,
+	// All particles start dead (age == lifetime == 0), the only upload they ever get
+	SDL_GPUTransferBufferCreateInfo tbufInfo = {
+		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+		.size = particleInfo.size,
 	};
+	SDL_GPUTransferBuffer* tbuf = NULL;
+	if (ps->particles && ps->instances && ps->drawArgs)
+		tbuf = SDL_CreateGPUTransferBuffer(sgl.device, &tbufInfo);
+	if (!tbuf) {
+		SGL_Error("Failed to create particle buffers: %s", SDL_GetError());
+		sgl_ReleaseParticleBuffers(ps);
+		SDL_free(ps);
+		return NULL;
+	}
 
-	SGL_Log("Creating Graphics Pipeline...");
-	SDL_GPUGraphicsPipeline* p = SDL_CreateGPUGraphicsPipeline(sgl.device, &pipelineInfo);
+	void* map = SDL_MapGPUTransferBuffer(sgl.device, tbuf, false);
+	SDL_memset(map, 0, tbufInfo.size);
+	SDL_UnmapGPUTransferBuffer(sgl.device, tbuf);
 
-	if (!p) {
-		SGL_Error("Pipeline Creation Failed! Error: %s", SDL_GetError());
-	} else {
-		SGL_Log("Pipeline Created Successfully.");
-	}
+	SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(sgl.device);
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(cmd);
+	SDL_GPUTransferBufferLocation src = { .transfer_buffer = tbuf, .offset = 0 };
+	SDL_GPUBufferRegion dst = { .buffer = ps->particles, .offset = 0, .size = tbufInfo.size };
+	SDL_UploadToGPUBuffer(copy, &src, &dst, false);
+	SDL_EndGPUCopyPass(copy);
+	SDL_SubmitGPUCommandBuffer(cmd);
 
-	return p;
+	SDL_ReleaseGPUTransferBuffer(sgl.device, tbuf);
+	return ps;
 }
 
-// --- Camera ---
-
-void sgl_SetMouseLock(bool lock) { SDL_SetWindowRelativeMouseMode(sgl.window, lock); }
+void sgl_DestroyParticleSystem(SGL_ParticleSystem* ps) {
+	if (!ps)
+		return;
+	sgl_ReleaseParticleBuffers(ps);
+	SDL_free(ps);
+}
 
-void sgl_SetCamera(SGL_Camera* cam) {
-	if (cam) {
-		sgl.camera = *cam;
-	} else {
-		sgl.camera = (SGL_Camera){
-			0.0f,
-			1.0f,
-		};
-	}
+void sgl_SetParticleConfig(SGL_ParticleSystem* ps, const SGL_ParticleConfig* config) {
+	if (ps && config)
+		ps->config = *config;
 }
 
-void sgl_CameraInit(SGL_Camera* cam, f32 x, f32 y, f32 zoom) {
-	cam->x = x;
-	cam->y = y;
-	cam->zoom = (zoom <= 0.0f) ? 1.0f : zoom;
+void sgl_EmitParticles(SGL_ParticleSystem* ps, int count) {
+	if (ps && count > 0)
+		ps->burst += (Uint32)count;
 }
 
-// 2D Camera controller update things
-void sgl_CameraUpdate(SGL_Camera* cam) {
-	const bool* key = SDL_GetKeyboardState(NULL);
-	float speed = 5.0f;
+void sgl_UpdateParticleSystem(SGL_ParticleSystem* ps, f32 dt) {
+	if (!ps)
+		return;
+	if (!sgl.curCmd) {
+		SGL_Warn("sgl_UpdateParticleSystem called outside sgl_BeginDrawing");
+		return;
+	}
 
-	if (key[SDL_SCANCODE_LSHIFT])
-		speed += 3.0f;
-	if (key[SDL_SCANCODE_W])
-		cam->y -= speed;
-	if (key[SDL_SCANCODE_A])
-		cam->x -= speed;
-	if (key[SDL_SCANCODE_S])
-		cam->y += speed;
-	if (key[SDL_SCANCODE_D])
-		cam->x += speed;
-	if (key[SDL_SCANCODE_Q])
-		cam->zoom -= 0.05f;
-	if (key[SDL_SCANCODE_E])
-		cam->zoom += 0.05f;
+	SGL_TRACE_BEGIN("sgl_UpdateParticleSystem");
+	const SGL_ParticleConfig* c = &ps->config;
+
+	ps->emitAccum += c->emitRate * dt;
+	Uint32 emitCount = (Uint32)ps->emitAccum;
+	ps->emitAccum -= (f32)emitCount;
+	emitCount = SDL_min(emitCount + ps->burst, ps->capacity);
+	ps->burst = 0;
+
+	SGL_ParticleParams params = {
+		.emitter = { c->position.x, c->position.y, c->velocity.x, c->velocity.y },
+		.motion = { c->velocityRandom.x, c->velocityRandom.y, c->gravity.x, c->gravity.y },
+		.colorStart = { c->colorStart.r / 255.0f, c->colorStart.g / 255.0f,
+						c->colorStart.b / 255.0f, c->colorStart.a / 255.0f },
+		.colorEnd = { c->colorEnd.r / 255.0f, c->colorEnd.g / 255.0f,
+					  c->colorEnd.b / 255.0f, c->colorEnd.a / 255.0f },
+		.shape = { c->sizeStart, c->sizeEnd, c->lifetime, c->lifetimeRandom },
+		.frame = { dt, c->texture ? (f32)c->texture->id : -1.0f, 0, 0 },
+		.emit = { ps->nextSlot, emitCount, ps->capacity, ps->seed++ },
+	};
+	ps->nextSlot = (ps->nextSlot + emitCount) % ps->capacity;
 
-	if (cam->zoom < 0.1f)
-		cam->zoom = 0.1f;
+	// Zero the instance count, the dispatch counts the live particles back up
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(sgl.curCmd);
+	SDL_GPUTransferBufferLocation src = { .transfer_buffer = sgl.particleArgsReset, .offset = 0 };
+	SDL_GPUBufferRegion dst = {
+		.buffer = ps->drawArgs,
+		.offset = 0,
+		.size = sizeof(SDL_GPUIndirectDrawCommand),
+	};
+	SDL_UploadToGPUBuffer(copy, &src, &dst, true);
+	SDL_EndGPUCopyPass(copy);
+
+	// Last frame's draw may still read the instances, they are rewritten completely
+	SDL_GPUStorageBufferReadWriteBinding rw[3] = {
+		{ .buffer = ps->particles, .cycle = false },
+		{ .buffer = ps->instances, .cycle = true },
+		{ .buffer = ps->drawArgs, .cycle = false },
+	};
+	SDL_GPUComputePass* cp = SDL_BeginGPUComputePass(sgl.curCmd, NULL, 0, rw, 3);
+	SDL_BindGPUComputePipeline(cp, sgl.particlePipeline);
+	SDL_PushGPUComputeUniformData(sgl.curCmd, 0, &params, sizeof(params));
+	SDL_DispatchGPUCompute(cp, (ps->capacity + 63) / 64, 1, 1);
+	SDL_EndGPUComputePass(cp);
+
+	ps->simulated = true;
+	SGL_TRACE_END("sgl_UpdateParticleSystem");
 }
 
-// 3D Camera Controller
-void sgl_Camera3DUpdate(SGL_Camera3D* cam, SGL_CAMERA_MODE mode, f32 deltaTime) {
-	const f32 CAMERA_SPEED = cam->speed;
-	const f32 MOUSE_SENSITIVITY = 0.003f;
+void sgl_DrawParticleSystem(SGL_ParticleSystem* ps) {
+	if (!ps || !ps->simulated)
+		return;
 
-	float mouseX, mouseY;
-	SDL_GetRelativeMouseState(&mouseX, &mouseY);
+	if (sgl.currentMode != SGL_BATCH_2D) {
+		SGL_Warn("sgl_DrawParticleSystem called outside sgl_BeginMode2D");
+		return;
+	}
 
-	if (mode == CAMERA_FREE) {
-		// Calculte direction vector (Target - Position)
-		Vec3 forward = sgl_Vec3Sub(cam->target, cam->position);
-		f32 dist = sgl_Vec3length(forward);
-		forward = sgl_Vec3Normalize(forward);
+	// Keep the draw order, what is batched so far goes first
+	sgl_Flush(SGL_FLUSH_RETAINED);
+	if (sgl.frameSkipped && !sgl.renderTarget)
+		return;
 
-		// Calculate Yaw and Pitch
-		f32 yaw = atan2f(forward.z, forward.x);
-		f32 pitch = asinf(forward.y);
+	// Untextured particles are circles, which have soft edges
+	SGL_PipelineState state = sgl_SoftEdgeState(sgl_CurrentPipelineState());
+	SDL_GPUGraphicsPipeline* pipeline = sgl_PipelineForState(state);
+	if (!pipeline)
+		return;
 
-		// Apply mouse deltas
-		yaw += mouseX * MOUSE_SENSITIVITY;
-		pitch -= mouseY * MOUSE_SENSITIVITY;
+	SDL_GPURenderPass* pass = sgl_BeginScenePass(pipeline, &sgl.currentMatrix, ps->instances);
+	if (!pass)
+		return;
+	SDL_DrawGPUPrimitivesIndirect(pass, ps->drawArgs, 0, 1);
+	sgl_EndScenePass(pass);
+}
 
-		// Clamp pitch
-		if (pitch > 1.55f)
-			pitch = 1.55f;
-		if (pitch < -1.55f)
-			pitch = -1.55f;
+// --- Sprite Pools ---
+// Sprites live in a storage buffer owned by the pool, with a CPU copy next to it. Changes
+// set a dirty bit per slot, and the next draw uploads the dirty slots as coalesced ranges.
+// Removed slots become zero sized quads and are reused, so handles never move.
+// The GPU copy is laid out for the mode it was drawn in last: rects in 2D, +Z voxel faces in
+// 3D (whose path would read a rect's width as z). Drawing in the other mode re-uploads it all.
+
+struct SGL_SpritePool {
+	SGL_InstanceData* instances; // CPU copy, uploads are taken from it
+	bool* alive;
+	Uint32* dirty;		 // one bit per slot
+	Uint32 dirtyMin;	 // bounds of the set bits, min > max = clean
+	Uint32 dirtyMax;
+	Uint32* ranges;		 // first, count pairs of the upload being built
+	Uint32* freeSlots;
+	Uint32 freeCount;
+	Uint32 capacity;
+	Uint32 used; // slots handed out so far, the draw covers [0, used)
+	Uint32 live;
+	bool layout3D; // the GPU copy holds voxel faces
+	SDL_GPUBuffer* buffer;
+	SDL_GPUTransferBuffer* transfer;
+	Uint32 transferSize;
+};
 
-		// Reconstruct forward vector from the new Yaw/Pitch
-		forward.x = cosf(pitch) * cosf(yaw);
-		forward.y = sinf(pitch);
-		forward.z = cosf(pitch) * sinf(yaw);
-		forward = sgl_Vec3Normalize(forward);
+SGL_SpritePool* sgl_CreateSpritePool(int capacity) {
+	if (capacity <= 0) {
+		SGL_Error("Sprite pool capacity must be positive (got %d)", capacity);
+		return NULL;
+	}
 
-		// update target based on position and new direction
-		cam->target = sgl_Vec3Add(cam->position, sgl_Vec3Scale(forward, dist));
+	SGL_SpritePool* pool = (SGL_SpritePool*)SDL_calloc(1, sizeof(SGL_SpritePool));
+	if (!pool)
+		return NULL;
+	pool->capacity = (Uint32)capacity;
+	pool->dirtyMin = UINT32_MAX;
+	pool->instances = (SGL_InstanceData*)SDL_malloc(pool->capacity * sizeof(SGL_InstanceData));
+	pool->alive = (bool*)SDL_calloc(pool->capacity, sizeof(bool));
+	pool->dirty = (Uint32*)SDL_calloc((pool->capacity + 31) / 32, sizeof(Uint32));
+	// A range is at least one dirty slot followed by more than SGL_SPRITE_POOL_MERGE_GAP clean ones
+	pool->ranges = (Uint32*)SDL_malloc((pool->capacity / (SGL_SPRITE_POOL_MERGE_GAP + 1) + 1) * 2 * sizeof(Uint32));
+	pool->freeSlots = (Uint32*)SDL_malloc(pool->capacity * sizeof(Uint32));
+
+	SDL_GPUBufferCreateInfo info = {
+		.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+		.size = pool->capacity * sizeof(SGL_InstanceData),
+	};
+	pool->buffer = SDL_CreateGPUBuffer(sgl.device, &info);
 
-		// update target based on position and new direction
-		const bool* keys = SDL_GetKeyboardState(NULL);
-		Vec3 moveDir = { 0, 0, 0 };
+	if (!pool->instances || !pool->alive || !pool->dirty || !pool->ranges || !pool->freeSlots ||
+		!pool->buffer) {
+		SGL_Error("Failed to create a sprite pool of %d: %s", capacity, SDL_GetError());
+		sgl_DestroySpritePool(pool);
+		return NULL;
+	}
+	return pool;
+}
 
-		// Recalculate forward/right vectors for movement
-		// ignoring the "right" vector so we move along the floor plane
-		Vec3 right = sgl_Vec3Cross(forward, cam->up);
-		right = sgl_Vec3Normalize(right);
+void sgl_DestroySpritePool(SGL_SpritePool* pool) {
+	if (!pool)
+		return;
+	if (pool->buffer)
+		SDL_ReleaseGPUBuffer(sgl.device, pool->buffer);
+	if (pool->transfer)
+		SDL_ReleaseGPUTransferBuffer(sgl.device, pool->transfer);
+	SDL_free(pool->instances);
+	SDL_free(pool->alive);
+	SDL_free(pool->dirty);
+	SDL_free(pool->ranges);
+	SDL_free(pool->freeSlots);
+	SDL_free(pool);
+}
 
-		f32 speed = CAMERA_SPEED * deltaTime;
-		if (keys[SDL_SCANCODE_LSHIFT])
-			speed *= 3.0f; // sprint
+static void sgl_SpritePoolMark(SGL_SpritePool* pool, Uint32 slot) {
+	pool->dirty[slot >> 5] |= 1u << (slot & 31);
+	pool->dirtyMin = SDL_min(pool->dirtyMin, slot);
+	pool->dirtyMax = SDL_max(pool->dirtyMax, slot);
+}
 
-		if (keys[SDL_SCANCODE_W])
-			moveDir = sgl_Vec3Add(moveDir, forward);
-		if (keys[SDL_SCANCODE_S])
-			moveDir = sgl_Vec3Sub(moveDir, forward);
-		if (keys[SDL_SCANCODE_A])
-			moveDir = sgl_Vec3Sub(moveDir, right);
-		if (keys[SDL_SCANCODE_D])
-			moveDir = sgl_Vec3Add(moveDir, right);
+static SGL_InstanceData* sgl_SpritePoolGet(SGL_SpritePool* pool, SGL_SpriteHandle handle) {
+	if (!pool || handle == 0 || handle > pool->used || !pool->alive[handle - 1])
+		return NULL;
+	sgl_SpritePoolMark(pool, handle - 1);
+	return &pool->instances[handle - 1];
+}
 
-		// Fly up/Down (Space/Ctrl)
-		if (keys[SDL_SCANCODE_E])
-			moveDir.y += 1.0f;
-		if (keys[SDL_SCANCODE_Q])
-			moveDir.y -= 1.0f;
+SGL_SpriteHandle sgl_SpritePoolAdd(SGL_SpritePool* pool, f32 x, f32 y, f32 w, f32 h, SGL_Texture* texture, SGL_COLOR color) {
+	if (!pool)
+		return 0;
 
-		// apply movement
-		cam->position = sgl_Vec3Add(cam->position, sgl_Vec3Scale(moveDir, speed));
-		cam->target = sgl_Vec3Add(cam->target, sgl_Vec3Scale(moveDir, speed));
+	Uint32 slot;
+	if (pool->freeCount > 0) {
+		slot = pool->freeSlots[--pool->freeCount];
+	} else if (pool->used < pool->capacity) {
+		slot = pool->used++;
+	} else {
+		SGL_Error("Sprite pool is full (%u)", pool->capacity);
+		return 0;
+	}
 
-	} else
+	SGL_InstanceData inst = sgl_MakeInstance(x, y, w, h, 0, 0, 0, 0.0f, SGL_SHAPE_RECT, color);
+	if (texture)
+		inst.texIndex = (f32)texture->id;
+	pool->instances[slot] = inst;
+	pool->alive[slot] = true;
+	pool->live++;
+	sgl_SpritePoolMark(pool, slot);
+	return slot + 1;
+}
 
-		if (mode == CAMERA_ORBITAL) {
-		const f32 PAN_SPEED = 5.0f * deltaTime;
-		const f32 ZOOM_SPEED = 0.5f;
+void sgl_SpritePoolRemove(SGL_SpritePool* pool, SGL_SpriteHandle handle) {
+	SGL_InstanceData* inst = sgl_SpritePoolGet(pool, handle);
+	if (!inst)
+		return;
+	*inst = sgl_MakeInstance(0, 0, 0, 0, 0, 0, 0, 0.0f, SGL_SHAPE_RECT, (SGL_COLOR){ 0, 0, 0, 0 });
+	pool->alive[handle - 1] = false;
+	pool->freeSlots[pool->freeCount++] = handle - 1;
+	pool->live--;
+}
 
-		// Calculate Direction
-		Vec3 dir = sgl_Vec3Sub(cam->position, cam->target);
-		f32 dist = sgl_Vec3length(dir);
-		dir = sgl_Vec3Normalize(dir);
+void sgl_SpritePoolSetPosition(SGL_SpritePool* pool, SGL_SpriteHandle handle, f32 x, f32 y) {
+	SGL_InstanceData* inst = sgl_SpritePoolGet(pool, handle);
+	if (inst) {
+		inst->x = x;
+		inst->y = y;
+	}
+}
 
-		// Mouse Scroll
-		f32 scroll = sgl_GetMouseWheelY();
-		if (scroll != 0.0f) {
-			const f32 ZOOM_FACTOR = 0.2f;
+void sgl_SpritePoolSetRect(SGL_SpritePool* pool, SGL_SpriteHandle handle, f32 x, f32 y, f32 w, f32 h) {
+	SGL_InstanceData* inst = sgl_SpritePoolGet(pool, handle);
+	if (inst) {
+		inst->x = x;
+		inst->y = y;
+		inst->w = w;
+		inst->h = h;
+	}
+}
 
-			dist -= (dist * scroll * ZOOM_FACTOR);
+void sgl_SpritePoolSetColor(SGL_SpritePool* pool, SGL_SpriteHandle handle, SGL_COLOR color) {
+	SGL_InstanceData* inst = sgl_SpritePoolGet(pool, handle);
+	if (inst) {
+		inst->r = color.r / 255.0f;
+		inst->g = color.g / 255.0f;
+		inst->b = color.b / 255.0f;
+		inst->a = color.a / 255.0f;
+	}
+}
 
-			if (dist < 0.5f) {
-				dist = 0.5f;
-			}
-			if (dist > 100.0f) {
-				dist = 100.0f;
-			}
+void sgl_SpritePoolSetTexture(SGL_SpritePool* pool, SGL_SpriteHandle handle, SGL_Texture* texture) {
+	SGL_InstanceData* inst = sgl_SpritePoolGet(pool, handle);
+	if (inst)
+		inst->texIndex = texture ? (f32)texture->id : -1.0f;
+}
+
+int sgl_SpritePoolCount(const SGL_SpritePool* pool) { return pool ? (int)pool->live : 0; }
+
+// The sprite as a single +Z voxel face (like sgl_SceneAddSprite) with its min corner at x, y
+static SGL_InstanceData sgl_SpriteToVoxelFace(const SGL_InstanceData* sprite) {
+	SGL_InstanceData face = *sprite;
+	face.w = 0.0f;
+	face.h = 0.0f;
+	face.angle = 0.0f;
+	face.ox = sprite->w;
+	face.oy = sprite->h;
+	face.z = 0.0f;
+	face.type = SGL_SHAPE_VOXEL_FACE;
+	face.p2 = 1.0f;
+	face.p3 = 1.0f;
+	return face;
+}
+
+// Upload the dirty slots in the frame's command buffer, before the draw that reads them.
+// Dirty slots closer than SGL_SPRITE_POOL_MERGE_GAP share one copy.
+static bool sgl_UploadSpritePool(SGL_SpritePool* pool) {
+	if (pool->dirtyMin > pool->dirtyMax)
+		return true;
+
+	Uint32 rangeCount = 0;
+	Uint32 total = 0;
+	Uint32 slot = pool->dirtyMin;
+	while (slot <= pool->dirtyMax) {
+		if (pool->dirty[slot >> 5] == 0) {
+			slot = (slot | 31) + 1; // whole word clean
+			continue;
+		}
+		if (!(pool->dirty[slot >> 5] & (1u << (slot & 31)))) {
+			slot++;
+			continue;
 		}
 
-		// Calculate current yaw and pitch
-		f32 yaw = atan2f(dir.z, dir.x);
-		f32 pitch = asinf(dir.y);
+		Uint32 first = slot;
+		Uint32 last = slot;
+		for (slot++; slot <= pool->dirtyMax && slot - last <= SGL_SPRITE_POOL_MERGE_GAP; slot++) {
+			if (pool->dirty[slot >> 5] & (1u << (slot & 31)))
+				last = slot;
+		}
+		pool->ranges[rangeCount * 2] = first;
+		pool->ranges[rangeCount * 2 + 1] = last - first + 1;
+		rangeCount++;
+		total += last - first + 1;
+		slot = last + 1;
+	}
 
-		// Apply Mouse Rotation
-		yaw += mouseX * MOUSE_SENSITIVITY;
-		pitch -= mouseY * MOUSE_SENSITIVITY;
+	Uint32 bytes = total * sizeof(SGL_InstanceData);
+	if (pool->transferSize < bytes) {
+		if (pool->transfer)
+			SDL_ReleaseGPUTransferBuffer(sgl.device, pool->transfer);
+		// Room for a bigger change next time without reallocating
+		Uint32 size = SDL_min(SDL_max(bytes + bytes / 2, 64 * 1024), pool->capacity * (Uint32)sizeof(SGL_InstanceData));
+		SDL_GPUTransferBufferCreateInfo info = {
+			.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
+			.size = size,
+		};
+		pool->transfer = SDL_CreateGPUTransferBuffer(sgl.device, &info);
+		pool->transferSize = pool->transfer ? size : 0;
+		if (!pool->transfer) {
+			SGL_Error("Failed to create the sprite pool transfer buffer: %s", SDL_GetError());
+			return false;
+		}
+	}
 
-		// yaw -= mouseX * MOUSE_SENSITIVITY;
-		// pitch += mouseY * MOUSE_SENSITIVITY;
+	SGL_TRACE_BEGIN("sgl_DrawSpritePool.upload");
+	// Cycled, last frame's copy may still be reading it
+	Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(sgl.device, pool->transfer, true);
+	if (!map) {
+		SGL_Error("Failed to map the sprite pool transfer buffer: %s", SDL_GetError());
+		SGL_TRACE_END("sgl_DrawSpritePool.upload");
+		return false;
+	}
+	Uint32 offset = 0;
+	for (Uint32 i = 0; i < rangeCount; i++) {
+		Uint32 first = pool->ranges[i * 2];
+		Uint32 count = pool->ranges[i * 2 + 1];
+		if (pool->layout3D) {
+			SGL_InstanceData* out = (SGL_InstanceData*)(map + offset);
+			for (Uint32 j = 0; j < count; j++)
+				out[j] = sgl_SpriteToVoxelFace(&pool->instances[first + j]);
+		} else {
+			SDL_memcpy(map + offset, &pool->instances[first], count * sizeof(SGL_InstanceData));
+		}
+		offset += count * sizeof(SGL_InstanceData);
+	}
+	SDL_UnmapGPUTransferBuffer(sgl.device, pool->transfer);
 
-		// Clamp Pitch
-		if (pitch > 1.55f)
-			pitch = 1.55f;
-		if (pitch < -1.55f)
-			pitch = -1.55f;
+	SDL_GPUCopyPass* copy = SDL_BeginGPUCopyPass(sgl.curCmd);
+	offset = 0;
+	for (Uint32 i = 0; i < rangeCount; i++) {
+		Uint32 size = pool->ranges[i * 2 + 1] * sizeof(SGL_InstanceData);
+		SDL_GPUTransferBufferLocation src = { .transfer_buffer = pool->transfer, .offset = offset };
+		SDL_GPUBufferRegion dst = {
+			.buffer = pool->buffer,
+			.offset = pool->ranges[i * 2] * (Uint32)sizeof(SGL_InstanceData),
+			.size = size,
+		};
+		SDL_UploadToGPUBuffer(copy, &src, &dst, false);
+		offset += size;
+	}
+	SDL_EndGPUCopyPass(copy);
+	SGL_TRACE_END("sgl_DrawSpritePool.upload");
 
-		// reconstruct new direction vector
-		dir.x = cosf(pitch) * cosf(yaw);
-		dir.y = sinf(pitch);
-		dir.z = cosf(pitch) * sinf(yaw);
-		dir = sgl_Vec3Normalize(dir);
+	SDL_memset(&pool->dirty[pool->dirtyMin >> 5], 0, ((pool->dirtyMax >> 5) - (pool->dirtyMin >> 5) + 1) * sizeof(Uint32));
+	pool->dirtyMin = UINT32_MAX;
+	pool->dirtyMax = 0;
+	sgl.stats.instanceBytesUploaded += bytes;
+	return true;
+}
 
-		// WASD Panning
-		const bool* keys = SDL_GetKeyboardState(NULL);
-		Vec3 moveDir = { 0, 0, 0 };
+void sgl_DrawSpritePool(SGL_SpritePool* pool) {
+	if (!pool || pool->used == 0 || !sgl.curCmd)
+		return;
 
-		// Calculate flat forward vector
-		Vec3 flatForward = { -dir.x, 0.0f, -dir.z };
-		flatForward = sgl_Vec3Normalize(flatForward);
-		Vec3 right = sgl_Vec3Cross(flatForward, cam->up);
-		right = sgl_Vec3Normalize(right);
+	bool layout3D = sgl.currentMode == SGL_BATCH_3D;
+	if (layout3D != pool->layout3D) {
+		pool->layout3D = layout3D;
+		for (Uint32 slot = 0; slot < pool->used; slot++)
+			sgl_SpritePoolMark(pool, slot);
+	}
 
-		f32 speed = PAN_SPEED;
-		if (keys[SDL_SCANCODE_LSHIFT])
-			speed *= 3.0f; // Fast pan
+	// Keep the draw order, what is batched so far goes first
+	sgl_Flush(SGL_FLUSH_RETAINED);
+	if (!sgl_UploadSpritePool(pool))
+		return;
+	if (pool->live == 0 || (sgl.frameSkipped && !sgl.renderTarget))
+		return;
 
-		if (keys[SDL_SCANCODE_W])
-			moveDir = sgl_Vec3Add(moveDir, flatForward);
-		if (keys[SDL_SCANCODE_S])
-			moveDir = sgl_Vec3Sub(moveDir, flatForward);
-		if (keys[SDL_SCANCODE_A])
-			moveDir = sgl_Vec3Sub(moveDir, right);
-		if (keys[SDL_SCANCODE_D])
-			moveDir = sgl_Vec3Add(moveDir, right);
+	SDL_GPUGraphicsPipeline* pipeline = sgl_ResolvePipeline();
+	if (!pipeline)
+		return;
+
+	sgl.stats.instances += pool->live;
+	sgl_DrawInstances(pool->buffer, 6, pool->used, pipeline, &sgl.currentMatrix);
+}
 
-		// Apply panning to the TARGET
-		cam->target = sgl_Vec3Add(cam->target, sgl_Vec3Scale(moveDir, speed));
+// --- Retained Scene ---
+// Objects live in a BVH built top down (midpoint split of the centroid bounds).
+// Moves only refit the boxes. Adds go to a pending list tested linearly, and the
+// tree is rebuilt once enough has changed, on the next draw or query.
 
-		// Fly Up/Down (Pans target up and down)
-		if (keys[SDL_SCANCODE_SPACE])
-			cam->target.y += speed;
-		if (keys[SDL_SCANCODE_LCTRL])
-			cam->target.y -= speed;
+typedef struct {
+	Vec3 min;
+	Vec3 max;
+} SGL_AABB;
 
-		// Snap camera position back to the outside of the orbit sphere
-		cam->position = sgl_Vec3Add(cam->target, sgl_Vec3Scale(dir, dist));
+// Half of it is split spatially, count splits below keep the rest balanced
+#define SGL_SCENE_MAX_DEPTH 64
+
+typedef struct {
+	SGL_AABB box;
+	Uint32 first; // inner: left child (right = first + 1), leaf: first entry of `order`
+	Uint32 count; // 0 = inner node
+} SGL_BVHNode;
+
+typedef struct {
+	SGL_InstanceData inst;
+	SGL_AABB box;
+	bool alive;
+} SGL_SceneObject;
+
+struct SGL_Scene {
+	SGL_SceneObject* objects; // handle = index + 1
+	Uint32 objectCount;
+	Uint32 objectCapacity;
+	Uint32* freeSlots; // removed before the last rebuild, safe to reuse
+	Uint32 freeCount;
+	Uint32 aliveCount;
+
+	SGL_BVHNode* nodes;
+	Uint32 nodeCount;
+	Uint32* order; // object slots, grouped by leaf
+	Uint32 orderCount;
+
+	Uint32* pending; // added since the last rebuild, not in the tree yet
+	Uint32 pendingCount;
+	Uint32 changes; // moves and removes since the last rebuild
+	bool refit;
+	bool rebuild;
+};
+
+static SGL_AABB sgl_SceneObjectBox(const SGL_InstanceData* inst) {
+	if (inst->type == 100.0f) {
+		f32 e = inst->h * 0.5f;
+		return (SGL_AABB){ { inst->x - e, inst->y - e, inst->w - e }, { inst->x + e, inst->y + e, inst->w + e } };
 	}
+	return (SGL_AABB){ { inst->x, inst->y, inst->w }, { inst->x + inst->ox, inst->y + inst->oy, inst->w + inst->z } };
 }
 
-// --- Init/Shutdown ---
+static SGL_AABB sgl_AABBUnion(SGL_AABB a, SGL_AABB b) {
+	return (SGL_AABB){
+		{ SDL_min(a.min.x, b.min.x), SDL_min(a.min.y, b.min.y), SDL_min(a.min.z, b.min.z) },
+		{ SDL_max(a.max.x, b.max.x), SDL_max(a.max.y, b.max.y), SDL_max(a.max.z, b.max.z) },
+	};
+}
 
-static bool sgl_InternalInit(SDL_Window* window, SDL_GPUDevice* device) {
-	sgl.device = device;
-	sgl.window = window;
+static const SGL_AABB sgl_emptyAABB = { { 3.4e38f, 3.4e38f, 3.4e38f }, { -3.4e38f, -3.4e38f, -3.4e38f } };
 
-	// Check and Log Backend
-	const char* backend = SDL_GetGPUDeviceDriver(sgl.device);
-	SGL_Log("SGL Initialized. Graphics Backend: %s", backend);
+static bool sgl_AABBOverlap(SGL_AABB a, SGL_AABB b) {
+	return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y &&
+		   a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
 
-	SDL_ClaimWindowForGPUDevice(device, window);
-	SDL_GetWindowSizeInPixels(sgl.window, &sgl.winW, &sgl.winH);
+SGL_Scene* sgl_CreateScene(void) { return (SGL_Scene*)SDL_calloc(1, sizeof(SGL_Scene)); }
 
-	SDL_GPUSamplerCreateInfo samplerInfo = {
-		.min_filter = SDL_GPU_FILTER_NEAREST,
-		.mag_filter = SDL_GPU_FILTER_NEAREST,
-		.mipmap_mode = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST,
-		.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
-		.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE,
-	};
-	sgl.defaultSampler = SDL_CreateGPUSampler(sgl.device, &samplerInfo);
+void sgl_DestroyScene(SGL_Scene* scene) {
+	if (!scene)
+		return;
+	SDL_free(scene->objects);
+	SDL_free(scene->freeSlots);
+	SDL_free(scene->nodes);
+	SDL_free(scene->order);
+	SDL_free(scene->pending);
+	SDL_free(scene);
+}
 
-	SDL_GPUTextureCreateInfo texInfo = {
-		.type = SDL_GPU_TEXTURETYPE_2D_ARRAY,
-		.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM,
-		.width = SGL_TEXTURE_SIZE,
-		.height = SGL_TEXTURE_SIZE,
-		.layer_count_or_depth = SGL_MAX_TEXTURES,
-		.num_levels = 1,
-		.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER | SDL_GPU_TEXTUREUSAGE_COLOR_TARGET,
-	};
-	sgl.globalTextureArray = SDL_CreateGPUTexture(sgl.device, &texInfo);
-	sgl.nextTextureLayer = 0;
+static SGL_SceneHandle sgl_SceneAdd(SGL_Scene* scene, const SGL_InstanceData* inst) {
+	if (!scene)
+		return 0;
 
-	sgl.globalTextureBinding.sampler = sgl.defaultSampler;
-	sgl.globalTextureBinding.texture = sgl.globalTextureArray;
+	// pending and freeSlots never hold more than objectCapacity entries
+	if (scene->freeCount == 0 && scene->objectCount == scene->objectCapacity) {
+		Uint32 capacity = SDL_max(64, scene->objectCapacity * 2);
+		SGL_SceneObject* objects =
+			(SGL_SceneObject*)SDL_realloc(scene->objects, capacity * sizeof(SGL_SceneObject));
+		if (objects)
+			scene->objects = objects;
+		Uint32* pending = (Uint32*)SDL_realloc(scene->pending, capacity * sizeof(Uint32));
+		if (pending)
+			scene->pending = pending;
+		Uint32* freeSlots = (Uint32*)SDL_realloc(scene->freeSlots, capacity * sizeof(Uint32));
+		if (freeSlots)
+			scene->freeSlots = freeSlots;
+		if (!objects || !pending || !freeSlots) {
+			SGL_Error("Out of memory growing scene to %u objects", capacity);
+			return 0;
+		}
+		scene->objectCapacity = capacity;
+	}
 
-	SDL_GPUBufferCreateInfo bInfo = {
-		.usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
-		.size = SGL_MAX_INSTANCES * sizeof(SGL_InstanceData),
+	Uint32 slot = (scene->freeCount > 0) ? scene->freeSlots[--scene->freeCount] : scene->objectCount++;
+	SGL_SceneObject* obj = &scene->objects[slot];
+	obj->inst = *inst;
+	obj->box = sgl_SceneObjectBox(inst);
+	obj->alive = true;
+	scene->aliveCount++;
+
+	scene->pending[scene->pendingCount++] = slot;
+	if (scene->pendingCount > 64 + scene->aliveCount / 8)
+		scene->rebuild = true;
+	return slot + 1;
+}
+
+SGL_SceneHandle sgl_SceneAddCube(SGL_Scene* scene, Vec3 position, f32 size, SGL_Texture* texture, SGL_COLOR color) {
+	// Same layout as sgl_DrawCube
+	SGL_InstanceData inst = {
+		.x = position.x,
+		.y = position.y,
+		.w = position.z,
+		.h = size,
+		.type = 100.0f,
+		.texIndex = texture ? (f32)texture->id : -1.0f,
+		.r = color.r / 255.0f,
+		.g = color.g / 255.0f,
+		.b = color.b / 255.0f,
+		.a = color.a / 255.0f,
 	};
-	sgl.instanceBuffer = SDL_CreateGPUBuffer(device, &bInfo);
+	return sgl_SceneAdd(scene, &inst);
+}
 
-	SDL_GPUTransferBufferCreateInfo tInfo = {
-		.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD,
-		.size = SGL_MAX_INSTANCES * sizeof(SGL_InstanceData),
+SGL_SceneHandle sgl_SceneAddSprite(
+	SGL_Scene* scene,
+	Vec3 position,
+	f32 w,
+	f32 h,
+	SGL_Texture* texture,
+	SGL_COLOR color
+) {
+	// A single +Z voxel face (face 0, one UV repeat): min corner in x, y, w, extent in ox, oy, z
+	SGL_InstanceData inst = {
+		.x = position.x - w * 0.5f,
+		.y = position.y - h * 0.5f,
+		.w = position.z,
+		.h = 0.0f,
+		.angle = 0.0f,
+		.ox = w,
+		.oy = h,
+		.z = 0.0f,
+		.type = SGL_SHAPE_VOXEL_FACE,
+		.texIndex = texture ? (f32)texture->id : -1.0f,
+		.p2 = 1.0f,
+		.p3 = 1.0f,
+		.r = color.r / 255.0f,
+		.g = color.g / 255.0f,
+		.b = color.b / 255.0f,
+		.a = color.a / 255.0f,
 	};
-	sgl.transferBuffer = SDL_CreateGPUTransferBuffer(device, &tInfo);
+	return sgl_SceneAdd(scene, &inst);
+}
 
-	// LOAD DEFAULT SHADERS
-	SGL_Log("Load Default Shaders");
-	// Vertex shaders
-	SGL_Log("Load Default Vertex Shaders");
-	SDL_GPUShader* v = sgl_CreateShaderFromBytes(
-		default_vert,
-		sizeof(default_vert),
-		SDL_GPU_SHADERSTAGE_VERTEX,
-		1,
-		1,
-		0
-	);
+static SGL_SceneObject* sgl_SceneGet(SGL_Scene* scene, SGL_SceneHandle handle) {
+	if (!scene || handle == 0 || handle > scene->objectCount)
+		return NULL;
+	SGL_SceneObject* obj = &scene->objects[handle - 1];
+	return obj->alive ? obj : NULL;
+}
 
-	// Fragment shaders
-	SGL_Log("Load Default Fragment Shaders");
-	SDL_GPUShader* f = sgl_CreateShaderFromBytes(
-		default_frag,
-		sizeof(default_frag),
-		SDL_GPU_SHADERSTAGE_FRAGMENT,
-		0,
-		0,
-		1
-	);
+void sgl_SceneUpdate(SGL_Scene* scene, SGL_SceneHandle handle, Vec3 position) {
+	SGL_SceneObject* obj = sgl_SceneGet(scene, handle);
+	if (!obj)
+		return;
 
-	if (v && f) {
-		sgl.defaultPipeline = sgl_CreatePipeline(v, f);
-		sgl.activePipeline = sgl.defaultPipeline;
-		SDL_ReleaseGPUShader(device, v);
-		SDL_ReleaseGPUShader(device, f);
+	if (obj->inst.type == 100.0f) {
+		obj->inst.x = position.x;
+		obj->inst.y = position.y;
+		obj->inst.w = position.z;
 	} else {
-		SGL_Error("Failed to load embedded default shaders.");
-		return false;
+		obj->inst.x = position.x - obj->inst.ox * 0.5f;
+		obj->inst.y = position.y - obj->inst.oy * 0.5f;
+		obj->inst.w = position.z - obj->inst.z * 0.5f;
 	}
+	obj->box = sgl_SceneObjectBox(&obj->inst);
 
-	// Check if the depthbuffer or the window size is changing
-	sgl_CheckResize();
+	// Boxes only grow while refitting, rebuild once every object moved about once
+	scene->refit = true;
+	if (++scene->changes > 64 + scene->aliveCount)
+		scene->rebuild = true;
+}
 
-	return true;
+void sgl_SceneRemove(SGL_Scene* scene, SGL_SceneHandle handle) {
+	SGL_SceneObject* obj = sgl_SceneGet(scene, handle);
+	if (!obj)
+		return;
+
+	// Stays in the tree as a dead entry until the next rebuild
+	obj->alive = false;
+	scene->aliveCount--;
+	scene->refit = true;
+	if (++scene->changes > 64 + scene->aliveCount)
+		scene->rebuild = true;
 }
 
-void sgl_InitWindow(int w, int h, const char* title) {
+static Vec3 sgl_AABBCenter(SGL_AABB b) {
+	return (Vec3){ (b.min.x + b.max.x) * 0.5f, (b.min.y + b.max.y) * 0.5f, (b.min.z + b.max.z) * 0.5f };
+}
 
-	SDL_SetLogOutputFunction(sgl_LogOutputFunction, NULL);
+static f32 sgl_Vec3Axis(Vec3 v, int axis) { return (axis == 0) ? v.x : (axis == 1) ? v.y : v.z; }
+
+static void sgl_SceneBuildNode(SGL_Scene* scene, Uint32 nodeIndex, Uint32 first, Uint32 count, int depth) {
+	SGL_BVHNode* node = &scene->nodes[nodeIndex];
+	SGL_AABB box = sgl_emptyAABB;
+	SGL_AABB centers = sgl_emptyAABB;
+	for (Uint32 i = first; i < first + count; i++) {
+		SGL_AABB b = scene->objects[scene->order[i]].box;
+		Vec3 c = sgl_AABBCenter(b);
+		box = sgl_AABBUnion(box, b);
+		centers = sgl_AABBUnion(centers, (SGL_AABB){ c, c });
+	}
+	node->box = box;
 
-	SDL_SetLogPriority(SGL_LOG_CATEGORY, SDL_LOG_PRIORITY_INFO);
+	if (count <= SGL_SCENE_LEAF_SIZE) {
+		node->first = first;
+		node->count = count;
+		return;
+	}
 
-	SDL_Init(SDL_INIT_VIDEO);
-	SDL_Window* win = SDL_CreateWindow(title, w, h, SDL_WINDOW_RESIZABLE);
+	// Split the longest axis of the centers in the middle
+	Vec3 extent = { centers.max.x - centers.min.x, centers.max.y - centers.min.y, centers.max.z - centers.min.z };
+	int axis = (extent.y > extent.x) ? 1 : 0;
+	if (extent.z > sgl_Vec3Axis(extent, axis))
+		axis = 2;
+	f32 split = sgl_Vec3Axis(centers.min, axis) + sgl_Vec3Axis(extent, axis) * 0.5f;
+
+	Uint32 i = first;
+	Uint32 j = first + count;
+	while (i < j) {
+		if (sgl_Vec3Axis(sgl_AABBCenter(scene->objects[scene->order[i]].box), axis) < split) {
+			i++;
+		} else {
+			Uint32 tmp = scene->order[i];
+			scene->order[i] = scene->order[--j];
+			scene->order[j] = tmp;
+		}
+	}
 
-	// Initialize GPU with standard SPIR-V format support, this makes SDL3
-	// will be using Vulkan By default
-	SDL_GPUDevice* dev = SDL_CreateGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV, true, NULL);
+	// All centers on one side (stacked objects), or a very uneven distribution that
+	// would overflow the traversal stacks: split by count instead
+	Uint32 leftCount = i - first;
+	if (leftCount == 0 || leftCount == count || depth >= SGL_SCENE_MAX_DEPTH / 2)
+		leftCount = count / 2;
 
-	sgl_InternalInit(win, dev);
-}
+	Uint32 left = scene->nodeCount;
+	scene->nodeCount += 2;
+	node->first = left;
+	node->count = 0;
 
-void sgl_Shutdown() {
-	if (sgl.instanceBuffer)
-		SDL_ReleaseGPUBuffer(sgl.device, sgl.instanceBuffer);
-	if (sgl.transferBuffer)
-		SDL_ReleaseGPUTransferBuffer(sgl.device, sgl.transferBuffer);
-	if (sgl.defaultPipeline)
-		SDL_ReleaseGPUGraphicsPipeline(sgl.device, sgl.defaultPipeline);
+	sgl_SceneBuildNode(scene, left, first, leftCount, depth + 1);
+	sgl_SceneBuildNode(scene, left + 1, first + leftCount, count - leftCount, depth + 1);
+}
 
-	if (sgl.globalTextureArray) {
-		SDL_ReleaseGPUTexture(sgl.device, sgl.globalTextureArray);
+static bool sgl_SceneRebuild(SGL_Scene* scene) {
+	SGL_TRACE_BEGIN("sgl_SceneRebuild");
+
+	// Dead slots become reusable now that nothing refers to them
+	Uint32 orderCapacity = scene->aliveCount;
+	Uint32* order = (Uint32*)SDL_realloc(scene->order, SDL_max(orderCapacity, 1) * sizeof(Uint32));
+	SGL_BVHNode* nodes =
+		(SGL_BVHNode*)SDL_realloc(scene->nodes, SDL_max(2 * orderCapacity, 1) * sizeof(SGL_BVHNode));
+	if (order)
+		scene->order = order;
+	if (nodes)
+		scene->nodes = nodes;
+	if (!order || !nodes) {
+		SGL_Error("Out of memory rebuilding scene BVH (%u objects)", scene->aliveCount);
+		SGL_TRACE_END("sgl_SceneRebuild");
+		return false;
 	}
 
-	if (sgl.defaultSampler) {
-		SGL_Warn("Sampler texture was not cleaned up manually (Fixed automatically).");
-		SDL_ReleaseGPUSampler(sgl.device, sgl.defaultSampler);
+	scene->orderCount = 0;
+	scene->freeCount = 0;
+	for (Uint32 i = 0; i < scene->objectCount; i++) {
+		if (scene->objects[i].alive)
+			scene->order[scene->orderCount++] = i;
+		else
+			scene->freeSlots[scene->freeCount++] = i;
 	}
 
-	if (sgl.depthTexture) {
-		SGL_Warn("Depth texture was not cleaned up manually (Fixed automatically).");
-		SDL_ReleaseGPUTexture(sgl.device, sgl.depthTexture);
-		sgl.depthTexture = NULL;
+	scene->nodeCount = 1;
+	if (scene->orderCount > 0)
+		sgl_SceneBuildNode(scene, 0, 0, scene->orderCount, 0);
+	else
+		scene->nodes[0] = (SGL_BVHNode){ sgl_emptyAABB, 0, 0 };
+
+	scene->pendingCount = 0;
+	scene->changes = 0;
+	scene->refit = false;
+	scene->rebuild = false;
+	SGL_TRACE_END("sgl_SceneRebuild");
+	return true;
+}
+
+// Children always come after their parent, so one backwards pass refits everything
+static void sgl_SceneRefit(SGL_Scene* scene) {
+	for (Uint32 n = scene->nodeCount; n-- > 0;) {
+		SGL_BVHNode* node = &scene->nodes[n];
+		if (node->count == 0) {
+			node->box = sgl_AABBUnion(scene->nodes[node->first].box, scene->nodes[node->first + 1].box);
+			continue;
+		}
+		node->box = sgl_emptyAABB;
+		for (Uint32 i = node->first; i < node->first + node->count; i++) {
+			SGL_SceneObject* obj = &scene->objects[scene->order[i]];
+			if (obj->alive)
+				node->box = sgl_AABBUnion(node->box, obj->box);
+		}
 	}
+	scene->refit = false;
+}
 
-	SDL_DestroyGPUDevice(sgl.device);
-	SDL_DestroyWindow(sgl.window);
-	SDL_Quit();
-	SGL_Log("Shutdowning gracefully..");
+static bool sgl_ScenePrepare(SGL_Scene* scene) {
+	if (!scene->nodes || scene->rebuild)
+		return sgl_SceneRebuild(scene);
+	if (scene->refit)
+		sgl_SceneRefit(scene);
+	return true;
 }
 
-// --- Pipeline Switching ---
+// Side planes of the view projection. Near and far are left out because depth
+// is clamped, not clipped, so everything in front of the camera can show up.
+static void sgl_FrustumPlanes(const SGL_Matrix* m, f32 planes[4][4]) {
+	for (int i = 0; i < 4; i++) {
+		int row = i / 2;
+		f32 sign = (i & 1) ? -1.0f : 1.0f;
+		for (int c = 0; c < 4; c++)
+			planes[i][c] = m->m[c * 4 + 3] + sign * m->m[c * 4 + row];
+	}
+}
 
-void sgl_SetPipeline(SDL_GPUGraphicsPipeline* pipeline) {
-	sgl.activePipeline = pipeline ? pipeline : sgl.defaultPipeline;
+static bool sgl_AABBOutsidePlane(SGL_AABB b, const f32 p[4]) {
+	// The corner farthest along the plane normal
+	f32 x = (p[0] >= 0.0f) ? b.max.x : b.min.x;
+	f32 y = (p[1] >= 0.0f) ? b.max.y : b.min.y;
+	f32 z = (p[2] >= 0.0f) ? b.max.z : b.min.z;
+	return p[0] * x + p[1] * y + p[2] * z + p[3] < 0.0f;
 }
 
-SDL_GPUGraphicsPipeline* sgl_GetDefaultPipeline(void) { return sgl.defaultPipeline; }
+static bool sgl_AABBInFrustum(SGL_AABB b, f32 planes[4][4]) {
+	for (int i = 0; i < 4; i++) {
+		if (sgl_AABBOutsidePlane(b, planes[i]))
+			return false;
+	}
+	return true;
+}
 
-// --- Drawing ---
+void sgl_DrawScene(SGL_Scene* scene) {
+	if (!scene)
+		return;
+	if (sgl.currentMode != SGL_BATCH_3D) {
+		SGL_Warn("sgl_DrawScene called outside sgl_BeginMode3D");
+		return;
+	}
+	if (!sgl_ScenePrepare(scene))
+		return;
 
-// Draw Shapes
-void sgl_DrawRectangle(f32 x, f32 y, f32 w, f32 h, SGL_COLOR color) {
-	sgl_PushInstance(x, y, w, h, 0, 0, 0, -99.0f, SGL_SHAPE_RECT, color);
-}
+	SGL_TRACE_BEGIN("sgl_DrawScene");
+	f32 planes[4][4];
+	sgl_FrustumPlanes(&sgl.currentMatrix, planes);
+	Uint32 drawn = 0;
+
+	Uint32 stack[SGL_SCENE_MAX_DEPTH + 1];
+	int top = 0;
+	if (scene->orderCount > 0)
+		stack[top++] = 0;
+	while (top > 0) {
+		SGL_BVHNode* node = &scene->nodes[stack[--top]];
+		if (!sgl_AABBInFrustum(node->box, planes))
+			continue;
+
+		if (node->count == 0) {
+			stack[top++] = node->first;
+			stack[top++] = node->first + 1;
+			continue;
+		}
+		for (Uint32 i = node->first; i < node->first + node->count; i++) {
+			SGL_SceneObject* obj = &scene->objects[scene->order[i]];
+			if (obj->alive && sgl_AABBInFrustum(obj->box, planes)) {
+				sgl_EmitInstance(&obj->inst);
+				drawn++;
+			}
+		}
+	}
 
-void sgl_DrawRectanglePro(Rectangle rec, Vec2 origin, f32 rotation, SGL_COLOR color) {
-	sgl_PushInstance(
-		rec.x,
-		rec.y,
-		rec.w,
-		rec.h,
-		rotation,
-		origin.x,
-		origin.y,
-		0,
-		SGL_SHAPE_RECT,
-		color
-	);
-}
+	for (Uint32 i = 0; i < scene->pendingCount; i++) {
+		SGL_SceneObject* obj = &scene->objects[scene->pending[i]];
+		if (obj->alive && sgl_AABBInFrustum(obj->box, planes)) {
+			sgl_EmitInstance(&obj->inst);
+			drawn++;
+		}
+	}
 
-void sgl_DrawTriangle(f32 x, f32 y, f32 size, SGL_COLOR color) {
-	sgl_PushInstance(x, y, size, size, 0, size / 2, size / 2, 0, SGL_SHAPE_TRIG, color);
+	sgl.stats.culled += scene->aliveCount - drawn;
+	SGL_TRACE_END("sgl_DrawScene");
 }
 
-void sgl_DrawCircle(f32 x, f32 y, f32 radius, SGL_COLOR color) {
-	f32 diameter = radius * 2.0f;
-	sgl_PushInstance(
-		x - radius,
-		y - radius,
-		diameter,
-		diameter,
-		0,
-		0,
-		0,
-		0,
-		SGL_SHAPE_CIRCLE,
-		color
-	);
+// Slab test, entry distance in *t when the ray hits the box before maxT
+static bool sgl_RayAABB(Vec3 o, Vec3 inv, SGL_AABB b, f32 maxT, f32* t) {
+	f32 t0 = 0.0f, t1 = maxT;
+	for (int a = 0; a < 3; a++) {
+		f32 lo = (sgl_Vec3Axis(b.min, a) - sgl_Vec3Axis(o, a)) * sgl_Vec3Axis(inv, a);
+		f32 hi = (sgl_Vec3Axis(b.max, a) - sgl_Vec3Axis(o, a)) * sgl_Vec3Axis(inv, a);
+		if (lo > hi) {
+			f32 tmp = lo;
+			lo = hi;
+			hi = tmp;
+		}
+		// NaN (ray in the plane of a flat box) leaves the interval alone
+		t0 = (lo > t0) ? lo : t0;
+		t1 = (hi < t1) ? hi : t1;
+		if (t0 > t1)
+			return false;
+	}
+	*t = t0;
+	return true;
 }
 
-// 3D Object
-void sgl_DrawCube(Vec3 position, f32 size, SGL_Texture* texture, SGL_COLOR color) {
-	if (sgl.instanceCount >= SGL_MAX_INSTANCES)
-		sgl_Flush();
+SGL_SceneHandle sgl_SceneRaycast(SGL_Scene* scene, Vec3 origin, Vec3 dir, f32 maxDistance, f32* outDistance) {
+	if (!scene || !sgl_ScenePrepare(scene))
+		return 0;
 
-	// Determine texture index: -1.0f means "no texture"
-	float texIndex = (texture != NULL) ? (float)texture->id : -1.0f;
+	f32 len = SDL_sqrtf(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+	if (len <= 0.0f)
+		return 0;
+	dir = sgl_Vec3Scale(dir, 1.0f / len);
+	Vec3 inv = { 1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z };
+
+	SGL_SceneHandle best = 0;
+	f32 bestT = maxDistance;
+	f32 t;
+
+	Uint32 stack[SGL_SCENE_MAX_DEPTH + 1];
+	int top = 0;
+	if (scene->orderCount > 0)
+		stack[top++] = 0;
+	while (top > 0) {
+		SGL_BVHNode* node = &scene->nodes[stack[--top]];
+		if (!sgl_RayAABB(origin, inv, node->box, bestT, &t))
+			continue;
+
+		if (node->count == 0) {
+			stack[top++] = node->first;
+			stack[top++] = node->first + 1;
+			continue;
+		}
+		for (Uint32 i = node->first; i < node->first + node->count; i++) {
+			Uint32 slot = scene->order[i];
+			if (scene->objects[slot].alive && sgl_RayAABB(origin, inv, scene->objects[slot].box, bestT, &t)) {
+				best = slot + 1;
+				bestT = t;
+			}
+		}
+	}
 
-	// We reuse the existing struct.
-	// x,y,w = position, h = size.
-	// type = generic cube type (define a new enum SGL_SHAPE_CUBE = 100)
+	for (Uint32 i = 0; i < scene->pendingCount; i++) {
+		Uint32 slot = scene->pending[i];
+		if (scene->objects[slot].alive && sgl_RayAABB(origin, inv, scene->objects[slot].box, bestT, &t)) {
+			best = slot + 1;
+			bestT = t;
+		}
+	}
 
-	sgl.mappedPtr[sgl.instanceCount++] = (SGL_InstanceData){
-		.x = position.x,
-		.y = position.y,
-		.w = position.z, // Pos X, Y, Z
-		.h = size,		 // Size
-		.angle = 0,
-		.ox = 0,
-		.oy = 0,
-		.z = 0,			// Unused/Rotation
-		.type = 100.0f, // Magic number for CUBE in shader
-		.texIndex = texIndex,
-		.r = color.r / 255.0f,
-		.g = color.g / 255.0f,
-		.b = color.b / 255.0f,
-		.a = color.a / 255.0f,
-	};
+	if (best && outDistance)
+		*outDistance = bestT;
+	return best;
+}
+
+int sgl_SceneQueryBox(SGL_Scene* scene, Vec3 min, Vec3 max, SGL_SceneHandle* out, int maxOut) {
+	if (!scene || !sgl_ScenePrepare(scene))
+		return 0;
+
+	SGL_AABB query = { min, max };
+	int found = 0;
+
+	Uint32 stack[SGL_SCENE_MAX_DEPTH + 1];
+	int top = 0;
+	if (scene->orderCount > 0)
+		stack[top++] = 0;
+	while (top > 0) {
+		SGL_BVHNode* node = &scene->nodes[stack[--top]];
+		if (!sgl_AABBOverlap(node->box, query))
+			continue;
+
+		if (node->count == 0) {
+			stack[top++] = node->first;
+			stack[top++] = node->first + 1;
+			continue;
+		}
+		for (Uint32 i = node->first; i < node->first + node->count; i++) {
+			Uint32 slot = scene->order[i];
+			if (scene->objects[slot].alive && sgl_AABBOverlap(scene->objects[slot].box, query)) {
+				if (out && found < maxOut)
+					out[found] = slot + 1;
+				found++;
+			}
+		}
+	}
+
+	for (Uint32 i = 0; i < scene->pendingCount; i++) {
+		Uint32 slot = scene->pending[i];
+		if (scene->objects[slot].alive && sgl_AABBOverlap(scene->objects[slot].box, query)) {
+			if (out && found < maxOut)
+				out[found] = slot + 1;
+			found++;
+		}
+	}
+	return found;
 }
 
 // Drawing mode stuff
-void sgl_BeginDrawing(void) {
+bool sgl_BeginDrawing(void) {
+	SGL_TRACE_BEGIN("sgl_BeginDrawing");
+	sgl.frameStartCount = SDL_GetPerformanceCounter();
 	sgl.curCmd = SDL_AcquireGPUCommandBuffer(sgl.device);
 	sgl.instanceCount = 0;
-	sgl.mappedPtr =
-		(SGL_InstanceData*)SDL_MapGPUTransferBuffer(sgl.device, sgl.transferBuffer, true);
+	sgl.occlusionSlot = 0;
+	if (sgl.captureThread)
+		sgl_PollCaptures(false);
+
+	// A hidden window gets no swapchain image: draws are dropped like a skipped frame,
+	// render textures and compute work still run
+	bool hidden = sgl_IsWindowHidden();
 
 	// check each frame if the window size is changing and also assign depth buffer is there is none
 	// WARN: can cause segfault if there is no sgl_CheckResize!
-	sgl_CheckResize();
+	// Minimized windows can report a 0x0 size, keep the old depth buffer
+	if (!hidden)
+		sgl_CheckResize();
 
 	// Acquire ONCE and Store it
-	if (!SDL_WaitAndAcquireGPUSwapchainTexture(
+	SGL_TRACE_BEGIN("sgl_BeginDrawing.acquireSwapchain");
+	uint64_t waitStart = SDL_GetPerformanceCounter();
+	bool acquired;
+	if (hidden) {
+		acquired = true;
+		sgl.swapchainTex = NULL;
+	} else if (sgl.nonBlockingAcquire) {
+		// Returns true with a NULL texture when no image is ready yet
+		acquired =
+			SDL_AcquireGPUSwapchainTexture(sgl.curCmd, sgl.window, &sgl.swapchainTex, &sgl.swapchainW, &sgl.swapchainH);
+	} else {
+		acquired = SDL_WaitAndAcquireGPUSwapchainTexture(
 			sgl.curCmd,
 			sgl.window,
 			&sgl.swapchainTex,
-			NULL,
-			NULL
-		)) {
+			&sgl.swapchainW,
+			&sgl.swapchainH
+		);
+	}
+	if (!acquired) {
 		SGL_Error("Failed to acquire swapchain texture!");
 		sgl.swapchainTex = NULL;
 	}
+	sgl.stats.swapchainWaitMs += sgl_PerfToMs(SDL_GetPerformanceCounter() - waitStart);
+	SGL_TRACE_END("sgl_BeginDrawing.acquireSwapchain");
+
+	sgl.frameSkipped = acquired && (hidden || sgl.nonBlockingAcquire) && !sgl.swapchainTex;
+	sgl.stats.skipped = sgl.frameSkipped;
 
 	// Clear the screen immediately
 	if (sgl.swapchainTex) {
@@ -1862,23 +7846,42 @@ void sgl_BeginDrawing(void) {
 
 			SDL_BeginGPURenderPass(sgl.curCmd, &colorTargetInfo, 1, &depthTargetInfo);
 		SDL_EndGPURenderPass(pass);
+		sgl.stats.renderPasses++;
 	}
+	SGL_TRACE_END("sgl_BeginDrawing");
+
+	return !sgl.frameSkipped;
 }
 
 void sgl_EndDrawing() {
+	SGL_TRACE_BEGIN("sgl_EndDrawing");
+	if (sgl.renderTarget) {
+		SGL_Warn("sgl_EndDrawing called inside sgl_BeginTextureMode");
+		sgl_EndTextureMode();
+	}
 	if (sgl.instanceCount > 0)
-		sgl_Flush();
-	SDL_SubmitGPUCommandBuffer(sgl.curCmd);
+		sgl_Flush(SGL_FLUSH_END_FRAME);
+	sgl_SubmitFrame();
+	sgl.frameCount++;
+	SGL_TRACE_END("sgl_EndDrawing");
+
+	sgl.stats.cpuFrameMs = sgl_PerfToMs(SDL_GetPerformanceCounter() - sgl.frameStartCount);
+	sgl_WaitForNextFrame();
+	sgl_EndFrameStats();
 }
 
 void sgl_BeginMode2D(SGL_Camera* camera) {
 	if (sgl.instanceCount > 0 && sgl.currentMode != SGL_BATCH_2D)
-		sgl_Flush();
+		sgl_Flush(SGL_FLUSH_MODE_SWITCH);
 	sgl.currentMode = SGL_BATCH_2D;
 
 	// Calculate Ortho Matrix
 	float w = (float)sgl.winW;
 	float h = (float)sgl.winH;
+	if (sgl.renderTarget) {
+		w = sgl.renderTarget->texture.width;
+		h = sgl.renderTarget->texture.height;
+	}
 
 	// Simple 2D Camera Matrix
 	SGL_Matrix ortho = sgl_MatOrtho(0, w, h, 0, -100, 100);
@@ -1895,27 +7898,45 @@ void sgl_BeginMode2D(SGL_Camera* camera) {
 		view.m[12] = half_w - ((camera->x + half_w) * camera->zoom);
 		view.m[13] = half_h - ((camera->y + half_h) * camera->zoom);
 
-		sgl.currentMatrix = sgl_MatMultiply(ortho, view);
+		sgl_SetBatchMatrix(sgl_MatMultiply(ortho, view));
 
+		// Invert the view transform at the screen corners for the culling rectangle
+		sgl.view.valid = camera->zoom > 0.0f;
+		if (sgl.view.valid) {
+			sgl.view.min = (Vec2){ -view.m[12] / camera->zoom, -view.m[13] / camera->zoom };
+			sgl.view.max = (Vec2){ (w - view.m[12]) / camera->zoom, (h - view.m[13]) / camera->zoom };
+		}
 	} else {
-		sgl.currentMatrix = ortho;
+		sgl_SetBatchMatrix(ortho);
+		sgl.view = (SGL_ViewRect){ true, { 0.0f, 0.0f }, { w, h } };
 	}
 }
 
-void sgl_EndMode2D(void) { sgl_Flush(); }
+void sgl_SetViewCulling(bool enable) { sgl.viewCulling = enable; }
+
+bool sgl_IsViewCullingEnabled(void) { return sgl.viewCulling; }
+
+// The batch stays open, so draws under another camera of the same mode can join it
+void sgl_EndMode2D(void) {}
 
 void sgl_BeginMode3D(SGL_Camera3D* cam) {
 	if (sgl.instanceCount > 0 && sgl.currentMode != SGL_BATCH_3D)
-		sgl_Flush();
+		sgl_Flush(SGL_FLUSH_MODE_SWITCH);
 	sgl.currentMode = SGL_BATCH_3D;
 
 	float aspect = (float)sgl.winW / (float)sgl.winH;
+	if (sgl.renderTarget)
+		aspect = sgl.renderTarget->texture.width / sgl.renderTarget->texture.height;
 	SGL_Matrix proj = sgl_MatPerspective(cam->fovy, aspect, 0.01, 1000.0);
 	SGL_Matrix view = sgl_MatLookAt(cam->position, cam->target, cam->up);
 
-	sgl.currentMatrix = sgl_MatMultiply(proj, view);
+	sgl_SetBatchMatrix(sgl_MatMultiply(proj, view));
+
+	// Sort keys are view depths along the camera forward axis
+	sgl.viewPos = cam->position;
+	sgl.viewDir = sgl_Vec3Normalize(sgl_Vec3Sub(cam->target, cam->position));
 }
 
-void sgl_EndMode3D(void) { sgl_Flush(); }
+void sgl_EndMode3D(void) {}
 
 #endif // SGL_IMPLEMENTATION
@@ -4,27 +4,97 @@ layout(location = 0) in vec4 inColor;
 layout(location = 1) in vec2 inUV;
 layout(location = 2) flat in int inTexIndex;
 layout(location = 3) flat in float inType;
+layout(location = 4) flat in vec2 inShape; // tilemap: [layer, tile size in px], line: [length, half thickness], SDF: [p2, p3]
+layout(location = 5) flat in vec2 inSize;  // 2D quad size
 
 // Binding 0: One massive texture array
 layout(set = 2, binding = 0) uniform sampler2DArray globalTextures;
 
 layout(location = 0) out vec4 outFragColor;
 
-void main() {
+// Signed distances, negative inside. p is relative to the shape center.
+float sdRoundRect(vec2 p, vec2 halfSize, float r) {
+    r = min(r, min(halfSize.x, halfSize.y));
+    vec2 q = abs(p) - halfSize + r;
+    return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;
+}
+
+// Ring slice centered on +x, opening `aperture` radians to both sides
+float sdArc(vec2 p, float aperture, float radius, float halfWidth) {
+    vec2 q = vec2(abs(p.y), p.x);
+    vec2 sc = vec2(sin(aperture), cos(aperture));
+    return ((sc.y * q.x > sc.x * q.y) ? length(q - sc * radius) : abs(length(q) - radius)) - halfWidth;
+}
+
+// Edge coverage over about one pixel, independent of zoom
+float coverage(float d) {
+    return clamp(0.5 - d / max(fwidth(d), 1e-5), 0.0, 1.0);
+}
+
+vec4 shade() {
     int type = int(inType);
 
-    // Circle Logic (Discard pixels outside radius)
-    if (type == 2) { 
-        if (length(inUV - 0.5) > 0.5) discard;
+    // 2D shapes are signed distance fields with the edge antialiased through alpha.
+    // Nothing here discards, so early depth testing stays on for every pipeline built from
+    // this shader. sgl draws batches with these shapes without depth writes instead.
+    float alpha = 1.0;
+    if (type == 2 || (type >= 5 && type <= 7)) {
+        vec2 halfSize = inSize * 0.5;
+        vec2 p = (inUV - 0.5) * inSize;
+        float radius = halfSize.x;
+        float d;
+        if (type == 2) { // CIRCLE
+            d = length(p) - radius;
+        } else if (type == 5) { // ROUNDED RECT, p2 = corner radius
+            d = sdRoundRect(p, halfSize, inShape.x);
+        } else if (type == 6) { // RING, p2 = thickness
+            d = abs(length(p) - (radius - inShape.x * 0.5)) - inShape.x * 0.5;
+        } else { // ARC, p2 = thickness, p3 = half aperture
+            d = sdArc(p, inShape.y, radius - inShape.x * 0.5, inShape.x * 0.5);
+        }
+        alpha = coverage(d);
+    }
+
+    // Line Logic: inUV is the position along/across the segment, round caps fill the joints
+    if (type == 4) {
+        vec2 q = vec2(inUV.x - clamp(inUV.x, 0.0, inShape.x), inUV.y);
+        return vec4(inColor.rgb, inColor.a * coverage(length(q) - inShape.y));
+    }
+
+    // Tilemap Logic: inTexIndex is a layer of tile indices, one texel per tile
+    // (index = r + g * 256, alpha 0 = empty), inUV is in tile units
+    if (type == 3) {
+        ivec2 cell = ivec2(floor(inUV));
+        vec4 packed = texelFetch(globalTextures, ivec3(cell, inTexIndex), 0);
+        if (packed.a == 0.0)
+            return vec4(0.0);
+
+        int index = int(packed.r * 255.0 + 0.5) + int(packed.g * 255.0 + 0.5) * 256;
+        float size = float(textureSize(globalTextures, 0).x);
+        int perRow = int(size / inShape.y);
+        vec2 tileOrigin = vec2(index % perRow, index / perRow) * inShape.y;
+        vec2 uv = (tileOrigin + fract(inUV) * inShape.y) / size;
+
+        return texture(globalTextures, vec3(uv, inShape.x)) * inColor;
     }
 
     // Texture Logic
+    vec4 color = inColor;
     if (inTexIndex >= 0) {
         // Sample from the array using the index as the "Z" coordinate
-        vec4 texColor = texture(globalTextures, vec3(inUV.x, inUV.y, float(inTexIndex)));
-        outFragColor = texColor * inColor;
-    } else {
-        // Solid Color
-        outFragColor = inColor;
+        // Merged voxel faces repeat the texture, the sampler clamps
+        vec2 uv = (type == 101) ? fract(inUV) : inUV;
+        vec4 texColor = texture(globalTextures, vec3(uv.x, uv.y, float(inTexIndex)));
+        color *= texColor;
     }
+    color.a *= alpha;
+    return color;
+}
+
+void main() {
+    outFragColor = shade();
+#ifdef PREMULTIPLY
+    // SGL_BLEND_MULTIPLY build (default_frag_multiply), its blend factors expect premultiplied color
+    outFragColor.rgb *= outFragColor.a;
+#endif
 }
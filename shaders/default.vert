@@ -12,15 +12,23 @@ layout(std430, set = 0, binding = 0) readonly buffer Instances {
     InstanceData data[];
 } instances;
 
+// Same buffer seen as points: a polyline instance is followed by its points
+layout(std430, set = 0, binding = 0) readonly buffer Points {
+    vec2 pos[];
+} points;
+
 // --- SET 1: Uniforms ---
+// One matrix per camera of the batch (SGL_MAX_BATCH_CAMERAS), selected per instance
 layout(set = 1, binding = 0) uniform Uniforms {
-    mat4 mvp;
+    mat4 cameras[8];
 };
 
 layout(location = 0) out vec4 outColor;
 layout(location = 1) out vec2 outUV;
 layout(location = 2) flat out int outTexIndex;
 layout(location = 3) flat out float outType;
+layout(location = 4) flat out vec2 outShape; // tilemap: [layer, tile size in px], line: [length, half thickness], SDF: [p2, p3]
+layout(location = 5) flat out vec2 outSize;  // 2D quad size, SDF shapes are evaluated in it
 
 // Cube Vertices
 const vec3 cubeVerts[36] = vec3[36](
@@ -32,27 +40,71 @@ const vec3 cubeVerts[36] = vec3[36](
     vec3(-0.5, -0.5, -0.5), vec3(-0.5, -0.5,  0.5), vec3(-0.5,  0.5,  0.5), vec3(-0.5,  0.5,  0.5), vec3(-0.5,  0.5, -0.5), vec3(-0.5, -0.5, -0.5) 
 );
 
+const vec2 faceUVs[6] = vec2[6](
+    vec2(0.0, 1.0), // Bottom-Left
+    vec2(1.0, 1.0), // Bottom-Right
+    vec2(1.0, 0.0), // Top-Right
+    vec2(1.0, 0.0), // Top-Right
+    vec2(0.0, 0.0), // Top-Left
+    vec2(0.0, 1.0)  // Bottom-Left
+);
+
+const vec2 quadCorners[6] = vec2[6](
+    vec2(0, 0), vec2(0, 1), vec2(1, 0),
+    vec2(1, 0), vec2(0, 1), vec2(1, 1)
+);
+
 void main() {
     InstanceData inst = instances.data[gl_InstanceIndex];
-    int type = int(inst.params2.x);
+    int typeBits = int(inst.params2.x); // shape + camera * 256
+    int type = typeBits & 255;
+    mat4 mvp = cameras[typeBits >> 8];
     vec3 localPos;
+    outShape = inst.params2.zw; // lines replace it
+    outSize = inst.rect.zw;
 
     if (type == 100) { // CUBE
         localPos = cubeVerts[gl_VertexIndex % 36];
         localPos *= inst.rect.w; 
         localPos += inst.rect.xyz;
 
-        const vec2 faceUVs[6] = vec2[6](
-          vec2(0.0, 1.0), // Bottom-Left
-          vec2(1.0, 1.0), // Bottom-Right
-          vec2(1.0, 0.0), // Top-Right
-          vec2(1.0, 0.0), // Top-Right
-          vec2(0.0, 0.0), // Top-Left
-          vec2(0.0, 1.0)  // Bottom-Left
-        );
-
         outUV = faceUVs[gl_VertexIndex % 6];
         outColor = inst.color; // Simplify lighting for now
+    } else if (type == 101) { // VOXEL FACE
+        // params.x = face (cubeVerts order), params.yzw = extent in blocks, params2.zw = UV repeats
+        int face = int(inst.params.x);
+        vec3 corner = cubeVerts[face * 6 + (gl_VertexIndex % 6)] + 0.5;
+        localPos = inst.rect.xyz + corner * inst.params.yzw;
+
+        outUV = faceUVs[gl_VertexIndex % 6] * inst.params2.zw;
+        outColor = inst.color;
+    } else if (type == 4) { // LINE
+        // params2.z = 0: one segment rect.xy -> rect.zw
+        // params2.z = n: polyline, n points right after this instance, 6 vertices per segment
+        int count = int(inst.params2.z);
+        int seg = gl_VertexIndex / 6;
+        vec2 a = inst.rect.xy, b = inst.rect.zw;
+        if (count > 0) {
+            int base = (gl_InstanceIndex + 1) * 8; // InstanceData is 8 vec2
+            a = points.pos[base + seg];
+            b = points.pos[base + seg + 1];
+        } else if (seg > 0) {
+            a = b; // 3D batches draw 36 vertices, collapse the rest
+        }
+
+        // Quad around the segment, grown by half the thickness on every side so the
+        // round caps of neighbouring segments overlap at the joints
+        float halfWidth = inst.params2.w * 0.5;
+        vec2 dir = b - a;
+        float len = length(dir);
+        dir = (len > 0.0) ? dir / len : vec2(1.0, 0.0);
+        vec2 corner = quadCorners[gl_VertexIndex % 6];
+        vec2 local = vec2(mix(-halfWidth, len + halfWidth, corner.x), mix(-halfWidth, halfWidth, corner.y));
+
+        localPos = vec3(a + dir * local.x + vec2(-dir.y, dir.x) * local.y, 0.0);
+        outUV = local;
+        outColor = inst.color;
+        outShape = vec2(len, halfWidth);
     } else { // 2D (Rect/Tri/Circle)
         vec2 corner;
         uint idx = gl_VertexIndex;
@@ -68,9 +120,16 @@ void main() {
         
         // outUV = vec2(corner.x, 1.0 - corner.y); // Flip Y for SDL/Vulkan
         outUV = corner;
+
+        // TILEMAP: params.yz = tiles in this region, UV runs in tile units
+        vec2 origin = inst.params.yz;
+        if (type == 3) {
+            outUV = corner * inst.params.yz;
+            origin = vec2(0.0);
+        }
         
         // 2D Rotation
-        vec2 p = (corner * inst.rect.zw) - inst.params.yz;
+        vec2 p = (corner * inst.rect.zw) - origin;
         float c = cos(inst.params.x), s = sin(inst.params.x);
         
         localPos = vec3(inst.rect.xy + vec2(p.x*c - p.y*s, p.x*s + p.y*c), inst.rect.z);
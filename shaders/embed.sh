@@ -0,0 +1,40 @@
+#!/bin/sh
+# Rebuilds the SPIR-V arrays embedded in sgl.h from the GLSL in this folder.
+# Needs glslc (Vulkan SDK) and xxd, spirv-val is used when it is installed.
+#   sh shaders/embed.sh
+set -e
+
+dir=$(cd "$(dirname "$0")" && pwd)
+header="$dir/../sgl.h"
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# embed <array in sgl.h> <glslc arguments...>
+embed() {
+	name=$1
+	shift
+	glslc "$@" -o "$tmp/$name.spv"
+	if command -v spirv-val >/dev/null 2>&1; then
+		spirv-val "$tmp/$name.spv"
+	fi
+
+	# 16 bytes per line, tab indented, no comma after the last one
+	xxd -i -c 16 <"$tmp/$name.spv" | sed 's/^ */\t/' >"$tmp/$name.inc"
+	awk -v start="const static uint8_t $name[] = {" -v inc="$tmp/$name.inc" '
+		$0 == start { print; while ((getline line < inc) > 0) print line; skip = 1; found = 1; next }
+		skip && $0 == "};" { skip = 0 }
+		!skip { print }
+		END { if (!found) exit 1 }
+	' "$header" >"$tmp/sgl.h" || { echo "embed.sh: $name[] not found in sgl.h" >&2; exit 1; }
+	cat "$tmp/sgl.h" >"$header"
+	echo "$name: $(wc -c <"$tmp/$name.spv") bytes"
+}
+
+embed default_vert "$dir/default.vert"
+embed default_frag "$dir/default.frag"
+embed default_frag_multiply -DPREMULTIPLY "$dir/default.frag"
+embed variant_quad_vert "$dir/variant.vert"
+embed variant_quad_rotated_vert -DROTATED "$dir/variant.vert"
+embed variant_cube_vert -DCUBE "$dir/variant.vert"
+embed variant_solid_frag "$dir/variant.frag"
+embed variant_textured_frag -DTEXTURED "$dir/variant.frag"
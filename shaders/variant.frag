@@ -0,0 +1,23 @@
+#version 450
+
+// Specialized copies of default.frag for batches without SDF shapes, tilemaps or lines.
+//   (none)     variant_solid_frag     untextured
+//   -DTEXTURED variant_textured_frag  textured or untextured
+
+layout(location = 0) in vec4 inColor;
+layout(location = 1) in vec2 inUV;
+layout(location = 2) flat in int inTexIndex;
+
+layout(set = 2, binding = 0) uniform sampler2DArray globalTextures;
+
+layout(location = 0) out vec4 outFragColor;
+
+void main() {
+#ifdef TEXTURED
+    if (inTexIndex >= 0) {
+        outFragColor = texture(globalTextures, vec3(inUV, float(inTexIndex))) * inColor;
+        return;
+    }
+#endif
+    outFragColor = inColor;
+}
@@ -0,0 +1,73 @@
+#version 450
+
+// Specialized copies of default.vert for batches that only hold one kind of instance.
+// Built with glslc from this one source and embedded by embed.sh:
+//   (none)    variant_quad_vert          2D rects, no rotation
+//   -DROTATED variant_quad_rotated_vert  2D rects
+//   -DCUBE    variant_cube_vert          3D cubes
+
+// --- SET 0: Instance Data ---
+struct InstanceData {
+    vec4 rect;    // [x, y, z, size]
+    vec4 params;  // [angle, ox, oy, unused]
+    vec4 params2; // [type, texIndex, p2, p3]
+    vec4 color;   // [r, g, b, a]
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer Instances {
+    InstanceData data[];
+} instances;
+
+// --- SET 1: Uniforms ---
+layout(set = 1, binding = 0) uniform Uniforms {
+    mat4 cameras[8];
+};
+
+layout(location = 0) out vec4 outColor;
+layout(location = 1) out vec2 outUV;
+layout(location = 2) flat out int outTexIndex;
+
+#ifdef CUBE
+const vec3 cubeVerts[36] = vec3[36](
+    vec3(-0.5, -0.5,  0.5), vec3( 0.5, -0.5,  0.5), vec3( 0.5,  0.5,  0.5), vec3( 0.5,  0.5,  0.5), vec3(-0.5,  0.5,  0.5), vec3(-0.5, -0.5,  0.5),
+    vec3( 0.5, -0.5, -0.5), vec3(-0.5, -0.5, -0.5), vec3(-0.5,  0.5, -0.5), vec3(-0.5,  0.5, -0.5), vec3( 0.5,  0.5, -0.5), vec3( 0.5, -0.5, -0.5),
+    vec3(-0.5,  0.5,  0.5), vec3( 0.5,  0.5,  0.5), vec3( 0.5,  0.5, -0.5), vec3( 0.5,  0.5, -0.5), vec3(-0.5,  0.5, -0.5), vec3(-0.5,  0.5,  0.5),
+    vec3(-0.5, -0.5, -0.5), vec3( 0.5, -0.5, -0.5), vec3( 0.5, -0.5,  0.5), vec3( 0.5, -0.5,  0.5), vec3(-0.5, -0.5,  0.5), vec3(-0.5, -0.5, -0.5),
+    vec3( 0.5, -0.5,  0.5), vec3( 0.5, -0.5, -0.5), vec3( 0.5,  0.5, -0.5), vec3( 0.5,  0.5, -0.5), vec3( 0.5,  0.5,  0.5), vec3( 0.5, -0.5,  0.5),
+    vec3(-0.5, -0.5, -0.5), vec3(-0.5, -0.5,  0.5), vec3(-0.5,  0.5,  0.5), vec3(-0.5,  0.5,  0.5), vec3(-0.5,  0.5, -0.5), vec3(-0.5, -0.5, -0.5)
+);
+
+const vec2 faceUVs[6] = vec2[6](
+    vec2(0.0, 1.0), vec2(1.0, 1.0), vec2(1.0, 0.0),
+    vec2(1.0, 0.0), vec2(0.0, 0.0), vec2(0.0, 1.0)
+);
+#else
+const vec2 quadCorners[6] = vec2[6](
+    vec2(0, 0), vec2(0, 1), vec2(1, 0),
+    vec2(1, 0), vec2(0, 1), vec2(1, 1)
+);
+#endif
+
+void main() {
+    InstanceData inst = instances.data[gl_InstanceIndex];
+    mat4 mvp = cameras[int(inst.params2.x) >> 8];
+
+#ifdef CUBE
+    vec3 localPos = cubeVerts[gl_VertexIndex] * inst.rect.w + inst.rect.xyz;
+    outUV = faceUVs[gl_VertexIndex % 6];
+#else
+    // 2D batches are drawn with 6 vertices per instance, no degenerate ones to skip
+    vec2 corner = quadCorners[gl_VertexIndex];
+    vec2 p = corner * inst.rect.zw - inst.params.yz;
+#ifdef ROTATED
+    float c = cos(inst.params.x), s = sin(inst.params.x);
+    p = vec2(p.x * c - p.y * s, p.x * s + p.y * c);
+#endif
+    vec3 localPos = vec3(inst.rect.xy + p, inst.rect.z);
+    outUV = corner;
+#endif
+
+    outColor = inst.color;
+    outTexIndex = int(inst.params2.y);
+    gl_Position = mvp * vec4(localPos, 1.0);
+}
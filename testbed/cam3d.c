@@ -22,17 +22,10 @@ int main() {
 	// IMPORTANT: Lock/Hide mouse for 3D controls
 	sgl_SetMouseLock(isMouseLocked);
 
-	uint64_t NOW = sgl_GetPerfCount();
-	uint64_t LAST = 0;
-	f32 deltaTime = 0.0f;
-
 	SGL_Texture* crateTex = sgl_LoadTexture("Tex.bmp");
 
 	while (!sgl_WindowShouldClose()) {
-		LAST = NOW;
-
-		NOW = sgl_GetPerfCount();
-		deltaTime = (f32)((NOW - LAST) / (double)sgl_GetPerfFreq());
+		f32 deltaTime = (f32)sgl_GetFrameTime();
 		// Update Camera
 
 		const bool* keys = SDL_GetKeyboardState(NULL);
@@ -0,0 +1,22 @@
+#define SGL_IMPLEMENTATION
+#include "../sgl.h"
+
+// Offline texture packer: bakes BMPs into one file for sgl_LoadTexturePack
+//   ./texpack textures.sgpk [-s 512] grass.bmp stone.bmp ...
+int main(int argc, char** argv) {
+	if (argc < 3) {
+		printf("usage: %s out.sgpk [-s layerSize] files.bmp...\n", argv[0]);
+		return 1;
+	}
+
+	const char* out = argv[1];
+	int layerSize = SGL_TEXTURE_SIZE;
+	int first = 2;
+	if (argc > 4 && SDL_strcmp(argv[2], "-s") == 0) {
+		layerSize = SDL_atoi(argv[3]);
+		first = 4;
+	}
+
+	bool ok = sgl_WriteTexturePack(out, (const char* const*)&argv[first], argc - first, layerSize);
+	return ok ? 0 : 1;
+}